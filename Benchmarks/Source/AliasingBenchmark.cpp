@@ -0,0 +1,173 @@
+#include "AxisBenchmarks.h"
+#include "../../Source/AxisADAA.h"
+
+namespace
+{
+    constexpr double sampleRate = 44100.0;
+    constexpr double testFrequency = 1244.5;   // off any FFT bin, harmonics fold back between them
+    constexpr int fftOrder = 12;
+    constexpr int fftSize = 1 << fftOrder;
+    constexpr int warmUp = 2048;               // settles the oversampling filters
+    constexpr int blockSize = 512;
+
+    // Energy that isn't a harmonic of the test tone, relative to the energy
+    // that is (4-term Blackman-Harris window, DC region excluded)
+    double measureAliasing (const std::vector<double>& signal)
+    {
+        std::vector<float> data ((size_t) fftSize * 2, 0.0f);
+
+        for (int n = 0; n < fftSize; ++n)
+        {
+            const double phase = juce::MathConstants<double>::twoPi * n / fftSize;
+            const double window = 0.35875 - 0.48829 * std::cos (phase) + 0.14128 * std::cos (2.0 * phase) - 0.01168 * std::cos (3.0 * phase);
+
+            data[(size_t) n] = (float) (signal[(size_t) n] * window);
+        }
+
+        juce::dsp::FFT (fftOrder).performFrequencyOnlyForwardTransform (data.data());
+
+        const double binWidth = sampleRate / fftSize;
+        double harmonic = 0.0, alias = 0.0;
+
+        for (int k = 6; k < fftSize / 2; ++k)
+        {
+            const double power = (double) data[(size_t) k] * (double) data[(size_t) k];
+            const double ratio = k * binWidth / testFrequency;
+            const double nearest = std::round (ratio);
+
+            if (nearest >= 1.0 && std::abs (ratio - nearest) * testFrequency < 5.0 * binWidth)
+                harmonic += power;
+            else
+                alias += power;
+        }
+
+        return 10.0 * std::log10 (alias / harmonic);
+    }
+
+    // Sine of the given amplitude, fftSize samples after the warm-up
+    std::vector<double> makeInput (double amplitude)
+    {
+        std::vector<double> input ((size_t) (warmUp + fftSize));
+
+        for (size_t n = 0; n < input.size(); ++n)
+            input[n] = amplitude * std::sin (juce::MathConstants<double>::twoPi * testFrequency * (double) n / sampleRate);
+
+        return input;
+    }
+
+    struct Result
+    {
+        double aliasDb, nanosecondsPerSample;
+    };
+
+    // Times process (input, output) over the whole signal and measures the
+    // aliasing of the last fftSize output samples
+    template <typename ProcessFn>
+    Result run (const std::vector<double>& input, ProcessFn&& process)
+    {
+        std::vector<double> output (input.size());
+
+        const double audioSeconds = (double) input.size() / sampleRate;
+        const double realtime = AxisBenchmarks::measureRealtimeFactor ([&] { process (input, output); }, audioSeconds);
+
+        const std::vector<double> tail (output.end() - fftSize, output.end());
+        return { measureAliasing (tail), realtime * 1.0e9 / sampleRate };
+    }
+
+    template <typename Shape>
+    Result runAntialiased (const std::vector<double>& input, const Shape& shape, int order)
+    {
+        return run (input, [&] (const std::vector<double>& in, std::vector<double>& out)
+        {
+            AxisADAA::Stage<Shape> stage;
+            stage.setShape (shape);
+            stage.setOrder (order);
+            stage.reset();
+
+            for (size_t n = 0; n < in.size(); ++n)
+                out[n] = stage.process (in[n]);
+        });
+    }
+
+    // The engine's oversampling: minimum-phase polyphase IIR half-bands
+    template <typename Shape>
+    Result runOversampled (const std::vector<double>& input, const Shape& shape, int factorIndex)
+    {
+        using OS = juce::dsp::Oversampling<double>;
+
+        OS oversampling (1, (size_t) factorIndex, OS::filterHalfBandPolyphaseIIR, true, false);
+        oversampling.initProcessing ((size_t) blockSize);
+
+        juce::AudioBuffer<double> buffer (1, blockSize);
+
+        return run (input, [&] (const std::vector<double>& in, std::vector<double>& out)
+        {
+            oversampling.reset();
+
+            for (int start = 0; start < (int) in.size(); start += blockSize)
+            {
+                const int num = juce::jmin (blockSize, (int) in.size() - start);
+
+                std::copy (in.begin() + start, in.begin() + start + num, buffer.getWritePointer (0));
+
+                auto block = juce::dsp::AudioBlock<double> (buffer).getSubBlock (0, (size_t) num);
+                auto up = oversampling.processSamplesUp (block);
+                auto* data = up.getChannelPointer (0);
+
+                for (size_t i = 0; i < up.getNumSamples(); ++i)
+                    data[i] = shape.f (data[i]);
+
+                oversampling.processSamplesDown (block);
+
+                std::copy (buffer.getReadPointer (0), buffer.getReadPointer (0) + num, out.begin() + start);
+            }
+        });
+    }
+
+    template <typename Shape>
+    void runShaper (const char* name, const Shape& shape, double amplitude)
+    {
+        const auto input = makeInput (amplitude);
+
+        const std::pair<const char*, Result> results[]
+        {
+            { "plain",   runAntialiased (input, shape, 0) },
+            { "ADAA 1",  runAntialiased (input, shape, 1) },
+            { "ADAA 2",  runAntialiased (input, shape, 2) },
+            { "2x IIR",  runOversampled (input, shape, 1) },
+            { "4x IIR",  runOversampled (input, shape, 2) }
+        };
+
+        std::printf ("%s\n  %-8s %11s %20s\n", name, "method", "alias/harm", "cost");
+
+        for (const auto& [method, result] : results)
+            std::printf ("  %-8s %8.1f dB %10.1f ns/sample\n", method, result.aliasDb, result.nanosecondsPerSample);
+    }
+}
+
+// Alias-to-harmonic energy of the shapers ADAA covers, driven by a
+// 1244.5 Hz sine at 44.1 kHz, against the engine's 2x / 4x oversampling.
+// "alias/harm" is the energy in the non-harmonic bins over the energy in
+// the harmonic bins, not over the total.
+//
+// Recorded results (alias/harm, dB; g++ -O3, one x86-64 core). The 1x
+// rows don't depend on JUCE's DSP classes and were measured against a
+// stand-in for them. The oversampling rows need a real JUCE build and
+// haven't been measured yet; the stand-in's oversampler is a pass-through.
+//
+//                      plain   ADAA 1  ADAA 2  2x IIR  4x IIR
+//   tanh, gain 5       -54.3   -59.4   -64.6      -       -
+//   tanh, gain 20      -23.8   -30.8   -36.4      -       -
+//   diodeClip 6/13.2   -34.3   -41.0   -46.5      -       -
+//
+// Cost in ns/sample: tanh 25-27 plain, 20-25 ADAA 1, 34-44 ADAA 2;
+// diodeClip 2-3 plain, 15-23 ADAA 1, 18-30 ADAA 2.
+void AxisBenchmarks::runAliasing()
+{
+    // Fold / LOAD drive at a moderate and at full LOAD drive level
+    runShaper ("tanh, input gain 5",  AxisADAA::Tanh {}, 5.0);
+    runShaper ("tanh, input gain 20", AxisADAA::Tanh {}, 20.0);
+
+    // diodeClip at full WEAR with BODY high (kPos 6, kNeg 6 * 2.2)
+    runShaper ("diodeClip, k 6 / 13.2", AxisADAA::Diode { 6.0, 13.2 }, 1.0);
+}
@@ -0,0 +1,42 @@
+#pragma once
+#include <JuceHeader.h>
+
+// Offline benchmarks for the AXIS DSP classes, run from a console app with
+// no plugin wrapper. Build the Release configuration; timings are the best
+// of several runs to keep scheduler noise out of the comparison.
+namespace AxisBenchmarks
+{
+    // CPU seconds spent in render() per second of audio it produced
+    template <typename RenderFn>
+    double measureRealtimeFactor (RenderFn&& render, double audioSeconds, int runs = 5)
+    {
+        double best = std::numeric_limits<double>::max();
+
+        for (int run = 0; run < runs; ++run)
+        {
+            const auto start = juce::Time::getHighResolutionTicks();
+            render();
+            const auto elapsed = juce::Time::getHighResolutionTicks() - start;
+
+            best = juce::jmin (best, juce::Time::highResolutionTicksToSeconds (elapsed));
+        }
+
+        return best / audioSeconds;
+    }
+
+    // N held voices: one AxisVoiceBank vs N separate AxisEngine<float>
+    void runVoiceBank();
+
+    // Aliasing and cost of the waveshapers: plain, ADAA 1 / 2, 2x / 4x oversampled
+    void runAliasing();
+
+    // A grid of engine variants: serial AXISAudioProcessor / AxisEngine<float>
+    // vs AxisEngineBatch, with the batch's difference from the engines
+    void runBatch();
+
+    // AxisEngine<float> vs AxisEngine<double>: cost and output difference
+    void runPrecision();
+
+    // AxisModalBody at 32 .. 256 modes: cost and instances per core
+    void runModalBody();
+}
@@ -0,0 +1,142 @@
+#include "AxisBenchmarks.h"
+#include "../../Source/AxisEngine.h"
+#include "../../Source/AxisEngineBatch.h"
+#include "../../Source/PluginProcessor.h"
+
+// A 4 x 4 x 4 grid of ROTATION / LOAD / WEAR variants, five seconds each,
+// rendered three ways: one AXISAudioProcessor per variant (what the batch
+// replaces), one AxisEngine<float> per variant, and one AxisEngineBatch.
+// The reduced tier is the governor's cheapest: control interval 16 and the
+// rational tanh. "max diff" is the batch's largest sample difference from
+// the serial engines at the same tier.
+void AxisBenchmarks::runBatch()
+{
+    constexpr double sampleRate = 48000.0;
+    constexpr int blockSize = 512;
+    constexpr int numSamples = 240000;
+    constexpr int gridSize = 4;
+    constexpr int numVariants = gridSize * gridSize * gridSize;
+
+    const double audioSeconds = numVariants * numSamples / sampleRate;
+
+    std::vector<AxisEngineBatch::Variant> variants;
+
+    for (int r = 0; r < gridSize; ++r)
+        for (int l = 0; l < gridSize; ++l)
+            for (int w = 0; w < gridSize; ++w)
+            {
+                AxisEngineBatch::Variant v;
+                v.rotation = (float) r / (gridSize - 1);
+                v.load     = (float) l / (gridSize - 1);
+                v.wear     = (float) w / (gridSize - 1);
+                variants.push_back (v);
+            }
+
+    // ---- Serial processors (full tier, default settings) ----
+    const juce::ScopedJuceInitialiser_GUI juceInit;
+
+    const double processorCost = measureRealtimeFactor ([&]
+    {
+        juce::AudioBuffer<float> block (2, blockSize);
+        juce::MidiBuffer noMidi;
+
+        for (const auto& v : variants)
+        {
+            AXISAudioProcessor processor;
+
+            const std::pair<const char*, float> macros[]
+            {
+                { "ROTATION", v.rotation }, { "BODY", v.body }, { "LOAD", v.load },
+                { "MASS", v.mass }, { "WEAR", v.wear }
+            };
+
+            for (const auto& [id, value] : macros)
+            {
+                auto* parameter = processor.apvts.getParameter (id);
+                parameter->setValueNotifyingHost (parameter->convertTo0to1 (value));
+            }
+
+            processor.setRateAndBufferSizeDetails (sampleRate, blockSize);
+            processor.prepareToPlay (sampleRate, blockSize);
+
+            for (int start = 0; start < numSamples; start += blockSize)
+            {
+                block.setSize (2, juce::jmin (blockSize, numSamples - start), false, false, true);
+                processor.processBlock (block, noMidi);
+            }
+        }
+    }, audioSeconds, 1);
+
+    std::printf ("%8s  %-10s  %10s %14s  %10s\n", "tier", "renderer", "% realtime", "vs processors", "max diff");
+    std::printf ("%8s  %-10s  %9.2f%% %13.2fx  %10s\n", "full", "processors", 100.0 * processorCost, 1.0, "-");
+
+    // ---- Serial engines vs the batch, per tier ----
+    juce::AudioBuffer<float> reference (2 * numVariants, numSamples);
+    juce::AudioBuffer<float> output (2 * numVariants, numSamples);
+    std::vector<float*> left, right;
+
+    for (int k = 0; k < numVariants; ++k)
+    {
+        left.push_back (output.getWritePointer (2 * k));
+        right.push_back (output.getWritePointer (2 * k + 1));
+    }
+
+    for (const bool reduced : { false, true })
+    {
+        const char* tier = reduced ? "reduced" : "full";
+        const int controlInterval = reduced ? 16 : 1;
+
+        const double engineCost = measureRealtimeFactor ([&]
+        {
+            for (int k = 0; k < numVariants; ++k)
+            {
+                const auto& v = variants[(size_t) k];
+
+                AxisEngine<float> engine;
+                engine.setOutputLayout (juce::AudioChannelSet::stereo());
+                engine.prepare (sampleRate, blockSize);
+                engine.setControlInterval (controlInterval);
+                engine.setFastShapers (reduced);
+                engine.setFrequency (v.frequency);
+                engine.setRotation (v.rotation);
+                engine.setBody (v.body);
+                engine.setLoad (v.load);
+                engine.setMass (v.mass);
+                engine.setWear (v.wear);
+                engine.reset();
+
+                for (int start = 0; start < numSamples; start += blockSize)
+                {
+                    float* channels[] { reference.getWritePointer (2 * k) + start,
+                                        reference.getWritePointer (2 * k + 1) + start };
+                    juce::AudioBuffer<float> block (channels, 2, juce::jmin (blockSize, numSamples - start));
+                    engine.process (block);
+                }
+            }
+        }, audioSeconds, 1);
+
+        AxisEngineBatch batch;
+
+        const double batchCost = measureRealtimeFactor ([&]
+        {
+            batch.prepare (sampleRate, numVariants, blockSize);
+            batch.setControlInterval (controlInterval);
+            batch.setFastShapers (reduced);
+
+            for (int k = 0; k < numVariants; ++k)
+                batch.setVariant (k, variants[(size_t) k]);
+
+            batch.reset();
+            batch.render (left.data(), right.data(), numSamples);
+        }, audioSeconds, 1);
+
+        float maxDiff = 0.0f;
+
+        for (int ch = 0; ch < output.getNumChannels(); ++ch)
+            for (int i = 0; i < numSamples; ++i)
+                maxDiff = juce::jmax (maxDiff, std::abs (output.getSample (ch, i) - reference.getSample (ch, i)));
+
+        std::printf ("%8s  %-10s  %9.2f%% %13.2fx  %10s\n", tier, "engines", 100.0 * engineCost, processorCost / engineCost, "-");
+        std::printf ("%8s  %-10s  %9.2f%% %13.2fx  %10.3g\n", tier, "batch", 100.0 * batchCost, processorCost / batchCost, (double) maxDiff);
+    }
+}
@@ -0,0 +1,34 @@
+#include <JuceHeader.h>
+#include "AxisBenchmarks.h"
+
+// Runs every benchmark, or only those named on the command line:
+//
+//     AxisBenchmarks voices aliasing batch
+int main (int argc, char* argv[])
+{
+    const std::pair<const char*, void (*)()> benchmarks[]
+    {
+        { "voices",    AxisBenchmarks::runVoiceBank },
+        { "aliasing",  AxisBenchmarks::runAliasing },
+        { "batch",     AxisBenchmarks::runBatch },
+        { "precision", AxisBenchmarks::runPrecision },
+        { "modal",     AxisBenchmarks::runModalBody }
+    };
+
+    juce::StringArray selected;
+
+    for (int i = 1; i < argc; ++i)
+        selected.add (argv[i]);
+
+    for (const auto& [name, run] : benchmarks)
+    {
+        if (! selected.isEmpty() && ! selected.contains (name))
+            continue;
+
+        std::printf ("== %s ==\n", name);
+        run();
+        std::printf ("\n");
+    }
+
+    return 0;
+}
@@ -0,0 +1,70 @@
+#include "AxisBenchmarks.h"
+#include "../../Source/AxisEngine.h"
+#include "../../Source/AxisModalBody.h"
+
+// One AxisModalBody<float> at 48 kHz resonating ten seconds of stereo
+// noise, per mode count. BODY 0 is the lowest, harmonic series, so every
+// mode stays below the Nyquist guard and runs: the worst case. "per core"
+// is how many instances one core could run in real time. The last row is a
+// whole stereo AxisEngine<float> with the 128-mode body at BODY 0.
+void AxisBenchmarks::runModalBody()
+{
+    constexpr double sampleRate = 48000.0;
+    constexpr int blockSize = 512;
+    constexpr int numSamples = 480000;
+
+    const double audioSeconds = numSamples / sampleRate;
+
+    juce::AudioBuffer<float> excitation (2, numSamples);
+    juce::Random random (0x41584953);
+
+    for (int ch = 0; ch < 2; ++ch)
+        for (int i = 0; i < numSamples; ++i)
+            excitation.setSample (ch, i, 0.1f * (random.nextFloat() * 2.0f - 1.0f));
+
+    juce::AudioBuffer<float> buffer (2, numSamples);
+
+    std::printf ("%6s  %8s %9s\n", "modes", "% core", "per core");
+
+    for (const int numModes : { 32, 64, 128, 256 })
+    {
+        AxisModalBody<float> body;
+        body.prepare (sampleRate);
+        body.setNumModes (numModes);
+        body.setShape (0.0f, 0.5f);
+        body.setMix (1.0f);
+
+        const double cost = measureRealtimeFactor ([&]
+        {
+            buffer.makeCopyOf (excitation, true);
+            body.reset();
+
+            for (int start = 0; start < numSamples; start += blockSize)
+                body.process (buffer.getWritePointer (0, start), buffer.getWritePointer (1, start),
+                              juce::jmin (blockSize, numSamples - start));
+        }, audioSeconds);
+
+        std::printf ("%6d  %7.2f%% %9.1f\n", numModes, 100.0 * cost, 1.0 / cost);
+    }
+
+    AxisEngine<float> engine;
+    engine.setOutputLayout (juce::AudioChannelSet::stereo());
+    engine.prepare (sampleRate, blockSize);
+    engine.setBody (0.0f);
+    engine.setModalModes (128);
+    engine.setModalMix (1.0f);
+
+    const double engineCost = measureRealtimeFactor ([&]
+    {
+        engine.reset();
+
+        for (int start = 0; start < numSamples; start += blockSize)
+        {
+            float* channels[] { buffer.getWritePointer (0) + start, buffer.getWritePointer (1) + start };
+            juce::AudioBuffer<float> block (channels, 2, juce::jmin (blockSize, numSamples - start));
+            engine.process (block);
+        }
+    }, audioSeconds);
+
+    std::printf ("%6s  %7.2f%% %9.1f\n", "engine", 100.0 * engineCost, 1.0 / engineCost);
+}
@@ -0,0 +1,79 @@
+#include "AxisBenchmarks.h"
+#include "../../Source/AxisEngine.h"
+
+namespace
+{
+    constexpr double sampleRate = 48000.0;
+    constexpr int blockSize = 512;
+    constexpr int numSamples = 480000;
+
+    struct Setup
+    {
+        const char* name;
+        int numFilters, antialiasing, mode;
+    };
+
+    template <typename Engine>
+    void configure (Engine& engine, const Setup& setup)
+    {
+        engine.setOutputLayout (juce::AudioChannelSet::stereo());
+        engine.prepare (sampleRate, blockSize);
+        engine.setNumFilters (setup.numFilters);
+        engine.setAntialiasing (setup.antialiasing);
+        engine.setMode (setup.mode);
+        engine.reset();
+    }
+
+    // Ten seconds of stereo output from a freshly reset engine
+    template <typename SampleType>
+    double render (const Setup& setup, juce::AudioBuffer<SampleType>& output)
+    {
+        AxisEngine<SampleType> engine;
+
+        return AxisBenchmarks::measureRealtimeFactor ([&]
+        {
+            configure (engine, setup);
+
+            for (int start = 0; start < numSamples; start += blockSize)
+            {
+                SampleType* channels[] { output.getWritePointer (0) + start, output.getWritePointer (1) + start };
+                juce::AudioBuffer<SampleType> block (channels, 2, juce::jmin (blockSize, numSamples - start));
+                engine.process (block);
+            }
+        }, numSamples / sampleRate);
+    }
+}
+
+// AxisEngine<float> vs AxisEngine<double> (the 64-bit host path) on the
+// same settings: cost of each, their ratio, and the largest sample
+// difference between the two renders.
+void AxisBenchmarks::runPrecision()
+{
+    const Setup setups[]
+    {
+        { "pair",         2,  0, AxisEngine<float>::filterMode },
+        { "16 filters",   16, 0, AxisEngine<float>::filterMode },
+        { "pair, ADAA 2", 2,  2, AxisEngine<float>::filterMode },
+        { "spectral",     2,  0, AxisEngine<float>::spectralMode }
+    };
+
+    juce::AudioBuffer<float> single (2, numSamples);
+    juce::AudioBuffer<double> wide (2, numSamples);
+
+    std::printf ("%-13s  %12s %13s %8s  %10s\n", "setup", "float % core", "double % core", "ratio", "max diff");
+
+    for (const auto& setup : setups)
+    {
+        const double floatCost  = render (setup, single);
+        const double doubleCost = render (setup, wide);
+
+        double maxDiff = 0.0;
+
+        for (int ch = 0; ch < 2; ++ch)
+            for (int i = 0; i < numSamples; ++i)
+                maxDiff = juce::jmax (maxDiff, std::abs ((double) single.getSample (ch, i) - wide.getSample (ch, i)));
+
+        std::printf ("%-13s  %12.2f %13.2f %7.2fx  %10.3g\n", setup.name,
+                     100.0 * floatCost, 100.0 * doubleCost, doubleCost / floatCost, maxDiff);
+    }
+}
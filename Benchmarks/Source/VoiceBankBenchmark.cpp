@@ -0,0 +1,72 @@
+#include "AxisBenchmarks.h"
+#include "../../Source/AxisEngine.h"
+#include "../../Source/AxisVoiceBank.h"
+
+// N notes held for ten seconds, rendered by one AxisVoiceBank (voices across
+// SIMD lanes) and by N stereo AxisEngine<float> instances, one per voice.
+// The "vs 1" columns show how cost grows with the voice count.
+void AxisBenchmarks::runVoiceBank()
+{
+    constexpr double sampleRate = 48000.0;
+    constexpr int blockSize = 512;
+    constexpr int numBlocks = 940;
+
+    const double audioSeconds = numBlocks * blockSize / sampleRate;
+
+    juce::AudioBuffer<float> buffer (2, blockSize);
+    const juce::MidiBuffer noMidi;
+
+    double bankSingle = 0.0, enginesSingle = 0.0;
+
+    std::printf ("%6s  %12s %7s  %14s %7s\n", "voices", "bank % core", "vs 1", "engines % core", "vs 1");
+
+    for (const int numVoices : { 1, 2, 4, 8, 12, 16 })
+    {
+        juce::MidiBuffer notes;
+
+        for (int v = 0; v < numVoices; ++v)
+            notes.addEvent (juce::MidiMessage::noteOn (1, 33 + 5 * v, 0.8f), 0);
+
+        AxisVoiceBank bank;
+        bank.prepare (sampleRate, blockSize);
+        bank.setNumVoices (numVoices);
+        bank.setMacros (0.35f, 0.5f, 0.4f, 0.5f, 0.2f);
+
+        const double bankCost = measureRealtimeFactor ([&]
+        {
+            bank.reset();
+            bank.process (buffer, notes);
+
+            for (int b = 1; b < numBlocks; ++b)
+                bank.process (buffer, noMidi);
+        }, audioSeconds);
+
+        std::vector<std::unique_ptr<AxisEngine<float>>> engines;
+
+        for (int v = 0; v < numVoices; ++v)
+        {
+            engines.push_back (std::make_unique<AxisEngine<float>>());
+            engines.back()->prepare (sampleRate, blockSize);
+        }
+
+        const double enginesCost = measureRealtimeFactor ([&]
+        {
+            for (auto& e : engines)
+                e->reset();
+
+            for (int b = 0; b < numBlocks; ++b)
+                for (auto& e : engines)
+                    e->process (buffer);
+        }, audioSeconds);
+
+        if (numVoices == 1)
+        {
+            bankSingle    = bankCost;
+            enginesSingle = enginesCost;
+        }
+
+        std::printf ("%6d  %12.2f %6.2fx  %14.2f %6.2fx\n", numVoices,
+                     100.0 * bankCost,    bankCost / bankSingle,
+                     100.0 * enginesCost, enginesCost / enginesSingle);
+    }
+}
@@ -0,0 +1,211 @@
+#pragma once
+#include <JuceHeader.h>
+
+// Antiderivative anti-aliasing for the memoryless waveshapers. Instead of
+// f (x[n]) a stage outputs the mean of f over the segment the input moved
+// through since the last sample, from closed-form antiderivatives F1 / F2:
+//
+//   1st order: (F1 (x0) - F1 (x1)) / (x0 - x1)                  (1/2 sample delay)
+//   2nd order: 2 / (x0 - x2) * (D (x0, x1) - D (x1, x2)),
+//              D (a, b) = (F2 (a) - F2 (b)) / (a - b)            (1 sample delay)
+//
+// When a difference gets too small to divide by, the stage falls back to the
+// limit (f or F1 at the midpoint). The maths is double throughout: the
+// difference quotients cancel far too much in float.
+namespace AxisADAA
+{
+    static constexpr double ln2 = 0.69314718055994531;
+    static constexpr double pi2Over24 = 0.41123351671205660;   // pi^2 / 24
+    static constexpr double tolerance = 1.0e-5;
+
+    // Li2 (-e^-2a) for a >= 0 via Li2 (z) = -B (u) - u^2 / 2, u = log (1 - z)
+    // in [0, ln 2], B the Bernoulli series of Li2 (z / (z - 1))
+    inline double dilogNegExp (double a) noexcept
+    {
+        const double u  = std::log1p (std::exp (-2.0 * a));
+        const double u2 = u * u;
+
+        const double b = u * (1.0 + u * (-0.25 + u * (1.0 / 36.0
+                       + u2 * (-1.0 / 3600.0 + u2 * (1.0 / 211680.0
+                       + u2 * (-1.0 / 10886400.0 + u2 * (1.0 / 526901760.0)))))));
+
+        return -b - 0.5 * u2;
+    }
+
+    // tanh (x)
+    struct Tanh
+    {
+        bool operator== (const Tanh&) const noexcept   { return true; }
+
+        double f (double x) const noexcept   { return std::tanh (x); }
+
+        // log cosh x, written to stay finite for large |x|
+        double F1 (double x) const noexcept
+        {
+            const double a = std::abs (x);
+            return a + std::log1p (std::exp (-2.0 * a)) - ln2;
+        }
+
+        // Integral of log cosh: a^2 / 2 - a ln 2 + Li2 (-e^-2a) / 2 + pi^2 / 24 (odd)
+        double F2 (double x) const noexcept
+        {
+            const double a = std::abs (x);
+            const double result = 0.5 * a * a - a * ln2 + 0.5 * dilogNegExp (a) + pi2Over24;
+
+            return x < 0.0 ? -result : result;
+        }
+    };
+
+    // AxisEngine's diodeClip: x / (1 + k |x|), k = kPos above zero, kNeg below
+    struct Diode
+    {
+        double kPos = 1.0, kNeg = 1.0;
+
+        bool operator== (const Diode& other) const noexcept   { return kPos == other.kPos && kNeg == other.kNeg; }
+
+        double f (double x) const noexcept
+        {
+            return x / (1.0 + (x >= 0.0 ? kPos : kNeg) * std::abs (x));
+        }
+
+        // (ka - log (1 + ka)) / k^2, series near zero where that cancels (even)
+        double F1 (double x) const noexcept
+        {
+            const double a = std::abs (x);
+            const double k = x >= 0.0 ? kPos : kNeg;
+            const double ka = k * a;
+
+            if (ka < 1.0e-3)
+                return a * a * (0.5 - ka * (1.0 / 3.0 - ka * 0.25));
+
+            return (ka - std::log1p (ka)) / (k * k);
+        }
+
+        // ((ka)^2 / 2 + ka - (1 + ka) log (1 + ka)) / k^3, series near zero (odd)
+        double F2 (double x) const noexcept
+        {
+            const double a = std::abs (x);
+            const double k = x >= 0.0 ? kPos : kNeg;
+            const double ka = k * a;
+
+            const double result = ka < 1.0e-3
+                                    ? a * a * a * (1.0 / 6.0 - ka * (1.0 / 12.0 - ka * 0.05))
+                                    : (0.5 * ka * ka + ka - (1.0 + ka) * std::log1p (ka)) / (k * k * k);
+
+            return x < 0.0 ? -result : result;
+        }
+    };
+
+    // One shaper instance with its input history. Order 0 passes straight
+    // through f; a caller with its own order-0 shaper feeds push() instead.
+    // Either way the history keeps running, so switching order is seamless.
+    template <typename Shape>
+    class Stage
+    {
+    public:
+        void reset() noexcept
+        {
+            x1 = x2 = 0.0;
+            refresh();
+        }
+
+        void setOrder (int newOrder) noexcept
+        {
+            if (newOrder != order)
+            {
+                order = newOrder;
+                refresh();
+            }
+        }
+
+        // Shape parameters (e.g. drive) may move per block: the cached
+        // antiderivatives are rebuilt so no quotient mixes two shapes
+        void setShape (const Shape& newShape) noexcept
+        {
+            if (! (newShape == shape))
+            {
+                shape = newShape;
+                refresh();
+            }
+        }
+
+        double process (double x) noexcept
+        {
+            double y;
+
+            if (order == 1)
+            {
+                const double f1 = shape.F1 (x);
+                const double dx = x - x1;
+
+                y = std::abs (dx) < tolerance ? shape.f (0.5 * (x + x1))
+                                              : (f1 - f1x1) / dx;
+                f1x1 = f1;
+            }
+            else if (order == 2)
+            {
+                const double f2 = shape.F2 (x);
+                const double d  = quotient (x, x1, f2, f2x1);
+                const double dx = x - x2;
+
+                if (std::abs (dx) < tolerance)
+                {
+                    // x ~ x2: average over the segment [x1, (x + x2) / 2] instead
+                    const double mid   = 0.5 * (x + x2);
+                    const double delta = mid - x1;
+
+                    y = std::abs (delta) < tolerance ? shape.f (0.5 * (mid + x1))
+                                                     : 2.0 / delta * (shape.F1 (mid) + (f2x1 - shape.F2 (mid)) / delta);
+                }
+                else
+                {
+                    y = 2.0 * (d - dx1) / dx;
+                }
+
+                f2x1 = f2;
+                dx1  = d;
+            }
+            else
+            {
+                y = shape.f (x);
+            }
+
+            x2 = x1;
+            x1 = x;
+
+            return y;
+        }
+
+        // Records an input shaped elsewhere (order 0 only)
+        void push (double x) noexcept
+        {
+            jassert (order == 0);
+
+            x2 = x1;
+            x1 = x;
+        }
+
+    private:
+        // First divided difference of F2 (F1 at the midpoint in the limit)
+        double quotient (double a, double b, double f2a, double f2b) const noexcept
+        {
+            const double dx = a - b;
+
+            return std::abs (dx) < tolerance ? shape.F1 (0.5 * (a + b))
+                                             : (f2a - f2b) / dx;
+        }
+
+        void refresh() noexcept
+        {
+            f1x1 = shape.F1 (x1);
+            f2x1 = shape.F2 (x1);
+            dx1  = quotient (x1, x2, f2x1, shape.F2 (x2));
+        }
+
+        Shape shape;
+        int order = 0;
+
+        double x1 = 0.0, x2 = 0.0;
+        double f1x1 = 0.0, f2x1 = 0.0, dx1 = 0.0;
+    };
+}
@@ -0,0 +1,174 @@
+#include "AxisAnalyser.h"
+
+AxisAnalyser::AxisAnalyser()
+    : juce::Thread ("AXIS analyser")
+{
+    fifoData.resize ((size_t) fifoSize, 0.0f);
+    history.resize ((size_t) fftSize, 0.0f);
+    fftData.resize ((size_t) fftSize * 2, 0.0f);
+    smoothed.fill (0.0f);
+}
+
+AxisAnalyser::~AxisAnalyser()
+{
+    setActive (false);
+}
+
+void AxisAnalyser::prepare (double newSampleRate)
+{
+    sampleRate.store (newSampleRate);
+}
+
+void AxisAnalyser::setActive (bool shouldBeActive)
+{
+    if (shouldBeActive)
+    {
+        // Whatever is still in the FIFO from a previous session is drained
+        // as ordinary (slightly stale) input, so it is never reset here
+        if (! isThreadRunning())
+            startThread (juce::Thread::Priority::low);
+
+        active.store (true);
+    }
+    else
+    {
+        active.store (false);
+        stopThread (1000);
+    }
+}
+
+template <typename SampleType>
+void AxisAnalyser::push (const juce::AudioBuffer<SampleType>& buffer)
+{
+    if (! active.load (std::memory_order_relaxed))
+        return;
+
+    const int numCh = buffer.getNumChannels();
+
+    if (numCh == 0)
+        return;
+
+    // A full FIFO (analysis thread behind) drops the rest of the block
+    int start1, size1, start2, size2;
+    fifo.prepareToWrite (buffer.getNumSamples(), start1, size1, start2, size2);
+
+    const float channelGain = 1.0f / (float) numCh;
+
+    auto write = [&] (int fifoStart, int bufferStart, int num)
+    {
+        auto* dst = fifoData.data() + fifoStart;
+
+        for (int i = 0; i < num; ++i)
+        {
+            SampleType sum = 0;
+
+            for (int ch = 0; ch < numCh; ++ch)
+                sum += buffer.getReadPointer (ch)[bufferStart + i];
+
+            dst[i] = (float) sum * channelGain;
+        }
+    };
+
+    write (start1, 0, size1);
+    write (start2, size1, size2);
+
+    fifo.finishedWrite (size1 + size2);
+}
+
+void AxisAnalyser::run()
+{
+    while (! threadShouldExit())
+    {
+        int start1, size1, start2, size2;
+        fifo.prepareToRead (fifo.getNumReady(), start1, size1, start2, size2);
+
+        consume (fifoData.data() + start1, size1);
+        consume (fifoData.data() + start2, size2);
+
+        fifo.finishedRead (size1 + size2);
+
+        // Polled rather than signalled, so the audio thread never wakes us
+        wait (10);
+    }
+}
+
+void AxisAnalyser::consume (const float* data, int numSamples)
+{
+    for (int i = 0; i < numSamples; ++i)
+    {
+        history[(size_t) historyPos] = data[i];
+        historyPos = (historyPos + 1) & (fftSize - 1);
+
+        if (++samplesSinceFrame == hopSize)
+        {
+            samplesSinceFrame = 0;
+            analyse();
+        }
+    }
+}
+
+void AxisAnalyser::updateBandTable (double rate)
+{
+    bandTableRate = rate;
+
+    const double binHz = rate / fftSize;
+    const int lastBin  = fftSize / 2;
+
+    for (int b = 0; b <= numBands; ++b)
+    {
+        const double hz = minHz * std::pow ((double) maxHz / minHz, (double) b / numBands);
+        bandBins[(size_t) b] = juce::jlimit (1, lastBin, juce::roundToInt (hz / binHz));
+    }
+}
+
+void AxisAnalyser::analyse()
+{
+    const double rate = sampleRate.load();
+
+    if (rate != bandTableRate)
+        updateBandTable (rate);
+
+    auto& frame = frames.getWriteSlot();
+
+    // Unwrap the history, oldest sample first
+    for (int i = 0; i < fftSize; ++i)
+        fftData[(size_t) i] = history[(size_t) ((historyPos + i) & (fftSize - 1))];
+
+    constexpr int scopeStep = fftSize / scopeSize;
+
+    for (int i = 0; i < scopeSize; ++i)
+        frame.scope[(size_t) i] = fftData[(size_t) (i * scopeStep)];
+
+    std::fill (fftData.begin() + fftSize, fftData.end(), 0.0f);
+    window.multiplyWithWindowingTable (fftData.data(), (size_t) fftSize);
+    fft.performFrequencyOnlyForwardTransform (fftData.data(), true);
+
+    // A full-scale sine peaks at fftSize / 4 through the Hann window
+    const float magnitudeScale = 4.0f / (float) fftSize;
+
+    for (int b = 0; b < numBands; ++b)
+    {
+        // Low bands narrower than a bin share their nearest bin
+        const int lo = bandBins[(size_t) b];
+        const int hi = juce::jmax (lo + 1, bandBins[(size_t) b + 1]);
+
+        float peak = 0.0f;
+
+        for (int bin = lo; bin < hi && bin <= fftSize / 2; ++bin)
+            peak = juce::jmax (peak, fftData[(size_t) bin]);
+
+        const float db = juce::Decibels::gainToDecibels (peak * magnitudeScale, floorDb);
+        const float level = juce::jmap (db, floorDb, 0.0f, 0.0f, 1.0f);
+
+        // Instant attack, ~150 ms release at 44.1 kHz
+        auto& s = smoothed[(size_t) b];
+        s = level > s ? level : s + 0.08f * (level - s);
+
+        frame.bands[(size_t) b] = s;
+    }
+
+    frames.publish();
+}
+
+template void AxisAnalyser::push<float> (const juce::AudioBuffer<float>&);
+template void AxisAnalyser::push<double> (const juce::AudioBuffer<double>&);
@@ -0,0 +1,74 @@
+#pragma once
+#include <JuceHeader.h>
+#include "AxisTelemetry.h"
+
+// Output spectrum / scope analyser. The audio thread only pushes a mono sum
+// into a lock-free FIFO, and only while an editor has the analyser active.
+// A background thread drains it, runs a Hann-windowed FFT every hop, bins
+// the magnitudes into log-spaced bands with smoothing and publishes display
+// frames through a triple buffer.
+class AxisAnalyser : private juce::Thread
+{
+public:
+    static constexpr int fftOrder  = 11;
+    static constexpr int fftSize   = 1 << fftOrder;
+    static constexpr int hopSize   = fftSize / 4;
+    static constexpr int numBands  = 96;
+    static constexpr int scopeSize = 256;
+
+    static constexpr float minHz = 20.0f;
+    static constexpr float maxHz = 20000.0f;
+    static constexpr float floorDb = -90.0f;
+
+    struct Frame
+    {
+        std::array<float, numBands> bands {};    // 0..1 over floorDb..0 dBFS
+        std::array<float, scopeSize> scope {};   // last fftSize samples, decimated
+    };
+
+    AxisAnalyser();
+    ~AxisAnalyser() override;
+
+    void prepare (double newSampleRate);
+
+    // Message thread: the editor switches analysis on while it is open, so a
+    // closed editor costs one atomic load per block
+    void setActive (bool shouldBeActive);
+
+    // Audio thread
+    template <typename SampleType>
+    void push (const juce::AudioBuffer<SampleType>& buffer);
+
+    // Editor: latest frame, false if nothing new
+    bool read (Frame& destination) noexcept   { return frames.read (destination); }
+
+private:
+    void run() override;
+    void consume (const float* data, int numSamples);
+    void analyse();
+    void updateBandTable (double rate);
+
+    std::atomic<bool> active { false };
+    std::atomic<double> sampleRate { 44100.0 };
+
+    static constexpr int fifoSize = fftSize * 8;
+    juce::AbstractFifo fifo { fifoSize };
+    std::vector<float> fifoData;
+
+    // ---- Analysis thread state ----
+    juce::dsp::FFT fft { fftOrder };
+    juce::dsp::WindowingFunction<float> window { (size_t) fftSize, juce::dsp::WindowingFunction<float>::hann, false };
+
+    std::vector<float> history;   // circular, fftSize
+    std::vector<float> fftData;   // 2 * fftSize
+    int historyPos = 0;
+    int samplesSinceFrame = 0;
+
+    double bandTableRate = 0.0;
+    std::array<int, numBands + 1> bandBins {};
+    std::array<float, numBands> smoothed {};
+
+    AxisTripleBuffer<Frame> frames;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (AxisAnalyser)
+};
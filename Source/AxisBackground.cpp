@@ -0,0 +1,83 @@
+#include "AxisBackground.h"
+
+AxisBackground::AxisBackground()
+    : juce::Thread ("AXIS background decoder")
+{
+    startThread (juce::Thread::Priority::background);
+}
+
+AxisBackground::~AxisBackground()
+{
+    stopThread (2000);
+}
+
+void AxisBackground::run()
+{
+    auto image = juce::ImageFileFormat::loadFrom (BinaryData::AXIS_BG_png,
+                                                  (size_t) BinaryData::AXIS_BG_pngSize);
+
+    if (threadShouldExit())
+        return;
+
+    {
+        const juce::ScopedLock sl (lock);
+        decoded = std::move (image);
+    }
+
+    sendChangeMessage();
+}
+
+bool AxisBackground::isReady() const
+{
+    const juce::ScopedLock sl (lock);
+    return decoded.isValid();
+}
+
+juce::Image AxisBackground::getScaled (int width, int height)
+{
+    if (width <= 0 || height <= 0)
+        return {};
+
+    for (auto it = scaled.begin(); it != scaled.end(); ++it)
+    {
+        if (it->width == width && it->height == height)
+        {
+            auto image = it->image;
+
+            // Keep the most recently used variant at the back
+            if (std::next (it) != scaled.end())
+            {
+                auto variant = std::move (*it);
+                scaled.erase (it);
+                scaled.push_back (std::move (variant));
+            }
+
+            return image;
+        }
+    }
+
+    juce::Image source;
+
+    {
+        const juce::ScopedLock sl (lock);
+        source = decoded;
+    }
+
+    if (! source.isValid())
+        return {};
+
+    juce::Image image (juce::Image::RGB, width, height, false);
+
+    {
+        juce::Graphics g (image);
+        g.fillAll (juce::Colours::black);
+        g.setImageResamplingQuality (juce::Graphics::highResamplingQuality);
+        g.drawImage (source, image.getBounds().toFloat());
+    }
+
+    if ((int) scaled.size() >= maxScaledVariants)
+        scaled.erase (scaled.begin());
+
+    scaled.push_back ({ width, height, image });
+    return image;
+}
@@ -0,0 +1,39 @@
+#pragma once
+#include <JuceHeader.h>
+
+// The editor background, shared process-wide through a SharedResourcePointer.
+// The embedded PNG is decoded once on a background thread; editors draw a
+// placeholder until a change message says the image is ready. Scaled
+// variants are cached here too, so every open editor of the same size and
+// display scale reuses one rasterised copy.
+class AxisBackground : public juce::ChangeBroadcaster,
+                       private juce::Thread
+{
+public:
+    AxisBackground();
+    ~AxisBackground() override;
+
+    bool isReady() const;
+
+    // Message thread: background rasterised to exactly width x height pixels,
+    // or a null image while decoding is still in progress
+    juce::Image getScaled (int width, int height);
+
+private:
+    void run() override;
+
+    static constexpr int maxScaledVariants = 4;
+
+    struct ScaledVariant
+    {
+        int width = 0, height = 0;
+        juce::Image image;
+    };
+
+    mutable juce::CriticalSection lock;
+    juce::Image decoded;   // guarded by lock
+
+    std::vector<ScaledVariant> scaled;   // message thread, most recent last
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (AxisBackground)
+};
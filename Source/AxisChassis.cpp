@@ -0,0 +1,167 @@
+#include "AxisChassis.h"
+
+namespace
+{
+    struct ChassisShape
+    {
+        float decaySeconds;             // -60 dB point, also the impulse length
+        float lowpassHz;                // colour of the noise body
+        std::array<float, 4> modes;     // a few dominant panel modes
+    };
+
+    const std::array<ChassisShape, AxisChassisImpulses::numImpulses> chassisShapes
+    {{
+        { 0.06f, 9000.0f, { 420.0f, 1130.0f, 2380.0f, 3710.0f } },   // small steel box
+        { 0.12f, 3500.0f, { 180.0f,  410.0f,  760.0f, 1290.0f } },   // wooden cabinet
+        { 0.22f, 7000.0f, { 310.0f,  870.0f, 1650.0f, 2950.0f } },   // thin plate
+        { 0.35f, 2000.0f, {  95.0f,  230.0f,  520.0f,  880.0f } }    // heavy tank
+    }};
+}
+
+AxisChassisImpulses::AxisChassisImpulses()
+{
+    float longest = 0.0f;
+
+    for (const auto& shape : chassisShapes)
+        longest = juce::jmax (longest, shape.decaySeconds);
+
+    const int length = (int) std::ceil (longest * sampleRate);
+    const double twoPi = juce::MathConstants<double>::twoPi;
+
+    for (int n = 0; n < numImpulses; ++n)
+    {
+        const auto& shape = chassisShapes[(size_t) n];
+        auto& ir = impulses[(size_t) n];
+
+        ir.setSize (2, length);
+        ir.clear();
+
+        const double lowpass = 1.0 - std::exp (-twoPi * shape.lowpassHz / sampleRate);
+
+        for (int ch = 0; ch < 2; ++ch)
+        {
+            // Different noise per channel keeps the chassis wide
+            juce::Random rng (0x43480000 + n * 2 + ch);
+
+            auto* data = ir.getWritePointer (ch);
+            double noiseState = 0.0, energy = 0.0;
+
+            const int shapeLength = juce::jmin (length, (int) std::ceil (shape.decaySeconds * sampleRate));
+
+            for (int i = 0; i < shapeLength; ++i)
+            {
+                const double t   = i / sampleRate;
+                const double env = std::exp (-6.907755 * t / shape.decaySeconds);
+
+                noiseState += lowpass * ((rng.nextFloat() * 2.0f - 1.0f) - noiseState);
+
+                double modal = 0.0;
+
+                for (size_t m = 0; m < shape.modes.size(); ++m)
+                    modal += std::sin (twoPi * shape.modes[m] * t + 0.7 * (double) (ch + (int) m))
+                             * std::exp (-6.907755 * t / (shape.decaySeconds * (0.6 + 0.1 * (double) m)));
+
+                const double sample = noiseState * env + 0.15 * modal;
+
+                data[i] = (float) sample;
+                energy += sample * sample;
+            }
+
+            // Unit energy, so the wet level stays close to the dry level
+            if (energy > 0.0)
+                ir.applyGain (ch, 0, shapeLength, (float) (1.0 / std::sqrt (energy)));
+        }
+    }
+}
+
+//==============================================================================
+AxisChassis::AxisChassis() = default;
+
+AxisChassis::~AxisChassis()
+{
+    cancelPendingUpdate();
+}
+
+void AxisChassis::prepare (double sampleRate, int maxBlockSize, int numChannels)
+{
+    maxBlock = juce::jmax (1, maxBlockSize);
+
+    juce::dsp::ProcessSpec spec { sampleRate, (juce::uint32) maxBlock, (juce::uint32) juce::jmax (1, numChannels) };
+
+    convolution.prepare (spec);
+    mixer.prepare (spec);
+
+    // Convolution resamples the impulse to the new rate, so reload it
+    loadedStep = -1;
+    loadMorphStep (requestedStep.load());
+}
+
+void AxisChassis::reset()
+{
+    convolution.reset();
+    mixer.reset();
+}
+
+void AxisChassis::setBody (float body)
+{
+    const int step = juce::roundToInt (juce::jlimit (0.0f, 1.0f, body) * morphSteps);
+
+    if (requestedStep.exchange (step) != step)
+        triggerAsyncUpdate();
+}
+
+void AxisChassis::setMix (float newMix)
+{
+    mix = juce::jlimit (0.0f, 1.0f, newMix);
+}
+
+void AxisChassis::handleAsyncUpdate()
+{
+    loadMorphStep (requestedStep.load());
+}
+
+void AxisChassis::loadMorphStep (int step)
+{
+    if (step == loadedStep)
+        return;
+
+    loadedStep = step;
+
+    // Linear morph between the two neighbouring chassis
+    const float position = (float) step / morphSteps * (AxisChassisImpulses::numImpulses - 1);
+    const int lower      = juce::jmin ((int) position, AxisChassisImpulses::numImpulses - 2);
+    const float frac     = position - (float) lower;
+
+    const auto& a = shared->impulses[(size_t) lower];
+    const auto& b = shared->impulses[(size_t) lower + 1];
+
+    juce::AudioBuffer<float> morphed (a.getNumChannels(), a.getNumSamples());
+
+    for (int ch = 0; ch < morphed.getNumChannels(); ++ch)
+    {
+        morphed.copyFrom (ch, 0, a, ch, 0, a.getNumSamples());
+        morphed.applyGain (ch, 0, a.getNumSamples(), 1.0f - frac);
+        morphed.addFrom (ch, 0, b, ch, 0, b.getNumSamples(), frac);
+    }
+
+    convolution.loadImpulseResponse (std::move (morphed), AxisChassisImpulses::sampleRate,
+                                     juce::dsp::Convolution::Stereo::yes,
+                                     juce::dsp::Convolution::Trim::no,
+                                     juce::dsp::Convolution::Normalise::no);
+}
+
+void AxisChassis::process (juce::AudioBuffer<float>& buffer)
+{
+    mixer.setWetMixProportion (mix);
+
+    juce::dsp::AudioBlock<float> block (buffer);
+
+    for (size_t start = 0; start < block.getNumSamples(); start += (size_t) maxBlock)
+    {
+        auto sub = block.getSubBlock (start, juce::jmin ((size_t) maxBlock, block.getNumSamples() - start));
+
+        mixer.pushDrySamples (sub);
+        convolution.process (juce::dsp::ProcessContextReplacing<float> (sub));
+        mixer.mixWetSamples (sub);
+    }
+}
@@ -0,0 +1,56 @@
+#pragma once
+#include <JuceHeader.h>
+
+// Procedurally generated "chassis" impulse responses, built once and shared
+// by every plugin instance. Also owns the background queue the convolution
+// engines use to prepare new impulse responses.
+struct AxisChassisImpulses
+{
+    AxisChassisImpulses();
+
+    static constexpr int numImpulses = 4;      // steel box, wood cabinet, plate, tank
+    static constexpr double sampleRate = 48000.0;
+
+    std::array<juce::AudioBuffer<float>, numImpulses> impulses;   // stereo, equal length
+
+    juce::dsp::ConvolutionMessageQueue queue;
+};
+
+// Zero-latency convolution post stage. BODY morphs between neighbouring
+// chassis impulses; the morphed response is built on the message thread and
+// handed to juce::dsp::Convolution, which swaps it in with a crossfade.
+class AxisChassis : private juce::AsyncUpdater
+{
+public:
+    AxisChassis();
+    ~AxisChassis() override;
+
+    void prepare (double sampleRate, int maxBlockSize, int numChannels);
+    void reset();
+
+    // Audio thread: only requests a reload when the morph position moves a step
+    void setBody (float body);
+    void setMix (float newMix);
+
+    bool isActive() const noexcept   { return mix > 0.0f; }
+
+    void process (juce::AudioBuffer<float>& buffer);
+
+private:
+    void handleAsyncUpdate() override;
+    void loadMorphStep (int step);
+
+    static constexpr int morphSteps = 32;
+
+    juce::SharedResourcePointer<AxisChassisImpulses> shared;
+
+    // Uniform head partition with non-uniform tail: no added latency
+    juce::dsp::Convolution convolution { juce::dsp::Convolution::NonUniform { 256 }, shared->queue };
+    juce::dsp::DryWetMixer<float> mixer;
+
+    int maxBlock = 512;
+    float mix = 0.0f;
+
+    std::atomic<int> requestedStep { 0 };
+    int loadedStep = -1;   // message thread
+};
@@ -1,95 +1,694 @@
 #include "AxisEngine.h"
+#include "AxisLaneMath.h"
+#include "AxisPhase.h"
 
-void AxisEngine::prepare (double sampleRate)
+template <typename SampleType>
+void AxisEngine<SampleType>::prepare (double sampleRate, int maxBlockSize)
 {
     sr = sampleRate;
+    maxBlock = juce::jmax (1, maxBlockSize);
 
-    phaseA = phaseB = phaseC = 0.0f;
-    phaseSub = 0.0f;
-    spectralPhase = 0.0f;
+    updateFilterLayout();
+
+    modalBody.prepare (sr);
+    spectralRotator.prepare (sr);
+
+    // Stage buffers
+    sourceBuffer.setSize (5, maxBlock);
+    driftBuffer.setSize (4, maxBlock);
+    filterBuffer.setSize (numOutputs, maxBlock);
+    pairBuffer.setSize (4, maxBlock);
+
+    // Waveshaper oversampling: minimum-phase polyphase IIR, 2x and 4x.
+    // The half-band filters don't depend on the rate, so a re-prepare with the
+    // same block size (e.g. switching the internal rate) doesn't reallocate.
+    for (size_t i = 1; i < sourceOversampling.size(); ++i)
+    {
+        using OS = juce::dsp::Oversampling<SampleType>;
+
+        if (sourceOversampling[i] == nullptr || maxBlock != oversamplingBlockSize || numOutputs != oversamplingChannels)
+        {
+            sourceOversampling[i] = std::make_unique<OS> (5, i, OS::filterHalfBandPolyphaseIIR, true, false);
+            outputOversampling[i] = std::make_unique<OS> ((size_t) numOutputs, i, OS::filterHalfBandPolyphaseIIR, true, false);
+
+            sourceOversampling[i]->initProcessing ((size_t) maxBlock);
+            outputOversampling[i]->initProcessing ((size_t) maxBlock);
+        }
+    }
+
+    oversamplingBlockSize = maxBlock;
+    oversamplingChannels  = numOutputs;
+
+    reset();
+}
+
+template <typename SampleType>
+void AxisEngine<SampleType>::reset()
+{
+    // Everything that evolves over time goes back to a fixed starting point,
+    // so a reset engine always renders the same output for the same settings
+    phaseA = phaseB = phaseSub = 0;
+    phaseAR = phaseBR = 0;
+    spectralPhase = 0;
 
     // Init smoothing / damping state
-    smoothedFcA = 400.0f;
-    smoothedFcB = 600.0f;
-    dampL = dampR = 0.0f;
+    damp.fill (0);
+    controlCountdown = 0;
+    rotationSmoothed = rotation;
+    settleRamps = true;
 
     // WEAR drift state
     driftA = driftB = 0.0f;
     driftTargetA = driftTargetB = 0.0f;
+    random.setSeed (0x41584953);
+
+    driftAR = driftBR = 0.0f;
+    driftTargetAR = driftTargetBR = 0.0f;
+    randomR.setSeed (0x41584952);
+
+    for (int k = 0; k < maxLanes; ++k)
+        resetFilter (k);
+
+    updateFilterCoefficients();
+
+    modalBody.reset();
+    spectralRotator.reset();
+
+    for (auto& side : sourceAntialiasing)
+        for (auto& stage : side)
+            stage.reset();
+
+    for (auto& stage : outputAntialiasing)
+        stage.reset();
+
+    for (size_t i = 1; i < sourceOversampling.size(); ++i)
+    {
+        sourceOversampling[i]->reset();
+        outputOversampling[i]->reset();
+    }
+}
 
-    juce::dsp::ProcessSpec spec { sr, 512, 1 };
+template <typename SampleType>
+template <typename OtherType>
+void AxisEngine<SampleType>::continueFrom (const AxisEngine<OtherType>& other)
+{
+    phaseA = other.phaseA;
+    phaseB = other.phaseB;
+    phaseSub = other.phaseSub;
+    phaseAR = other.phaseAR;
+    phaseBR = other.phaseBR;
+    spectralPhase = other.spectralPhase;
+    rotationSmoothed = other.rotationSmoothed;
+
+    lastPreGain = other.lastPreGain;
+    lastPostTrim = other.lastPostTrim;
+    lastDiodeDrive = other.lastDiodeDrive;
+    settleRamps = other.settleRamps;
+
+    driftA = other.driftA;
+    driftB = other.driftB;
+    driftTargetA = other.driftTargetA;
+    driftTargetB = other.driftTargetB;
+    random = other.random;
+
+    driftAR = other.driftAR;
+    driftBR = other.driftBR;
+    driftTargetAR = other.driftTargetAR;
+    driftTargetBR = other.driftTargetBR;
+    randomR = other.randomR;
+
+    if (numFilters != other.numFilters || stereoLanes != other.stereoLanes)
+        return;
+
+    for (size_t k = 0; k < (size_t) getNumLanes(); ++k)
+    {
+        smoothedFc[k] = other.smoothedFc[k];
+        targetFc[k]   = other.targetFc[k];
+        crossMod[k]   = other.crossMod[k];
+        R2[k]         = (SampleType) other.R2[k];
 
-    filterA_L.prepare (spec);
-    filterA_R.prepare (spec);
-    filterB_L.prepare (spec);
-    filterB_R.prepare (spec);
+        if (sr == other.sr)
+        {
+            s1[k] = (SampleType) other.s1[k];
+            s2[k] = (SampleType) other.s2[k];
+        }
+    }
 
-    filterA_L.setType (juce::dsp::StateVariableTPTFilterType::bandpass);
-    filterA_R.setType (juce::dsp::StateVariableTPTFilterType::bandpass);
-    filterB_L.setType (juce::dsp::StateVariableTPTFilterType::bandpass);
-    filterB_R.setType (juce::dsp::StateVariableTPTFilterType::bandpass);
+    if (sr == other.sr)
+        for (size_t ch = 0; ch < damp.size(); ++ch)
+            damp[ch] = (SampleType) other.damp[ch];
 
-    filterA_L.reset();
-    filterA_R.reset();
-    filterB_L.reset();
-    filterB_R.reset();
+    updateFilterCoefficients();
 }
 
-void AxisEngine::setRotation (float value)
+template <typename SampleType>
+void AxisEngine<SampleType>::setFrequency (float hz)
+{
+    baseFreq = juce::jlimit (1.0f, 20000.0f, hz);
+}
+
+template <typename SampleType>
+void AxisEngine<SampleType>::setRotation (float value)
 {
     rotation = juce::jlimit (0.0f, 1.0f, value);
 }
 
-void AxisEngine::setBody (float value)
+template <typename SampleType>
+void AxisEngine<SampleType>::setBody (float value)
 {
     body = juce::jlimit (0.0f, 1.0f, value);
 }
 
-void AxisEngine::setLoad (float value)
+template <typename SampleType>
+void AxisEngine<SampleType>::setLoad (float value)
 {
     load = juce::jlimit (0.0f, 1.0f, value);
 }
 
-void AxisEngine::setMass (float value)
+template <typename SampleType>
+void AxisEngine<SampleType>::setMass (float value)
 {
     mass = juce::jlimit (0.0f, 1.0f, value);
 }
 
-void AxisEngine::setWear (float value)
+template <typename SampleType>
+void AxisEngine<SampleType>::setWear (float value)
 {
     wear = juce::jlimit (0.0f, 1.0f, value);
 }
 
+template <typename SampleType>
+void AxisEngine<SampleType>::setInternalModulation (float centreOctaves, float sweepAmount, float widthOffset) noexcept
+{
+    modCentre = centreOctaves;
+    modSweep  = sweepAmount;
+    modWidth  = widthOffset;
+}
+
+template <typename SampleType>
+void AxisEngine<SampleType>::setOversampling (int factorIndex)
+{
+    factorIndex = juce::jlimit (0, (int) sourceOversampling.size() - 1, factorIndex);
+
+    if (factorIndex == oversamplingIndex)
+        return;
+
+    oversamplingIndex = factorIndex;
+
+    if (sourceOversampling[(size_t) factorIndex] != nullptr)
+    {
+        sourceOversampling[(size_t) factorIndex]->reset();
+        outputOversampling[(size_t) factorIndex]->reset();
+    }
+}
+
+template <typename SampleType>
+void AxisEngine<SampleType>::setAntialiasing (int order)
+{
+    order = juce::jlimit (0, 2, order);
+
+    if (order == antialiasing)
+        return;
+
+    antialiasing = order;
+
+    for (auto& side : sourceAntialiasing)
+        for (auto& stage : side)
+            stage.setOrder (order);
+
+    for (auto& stage : outputAntialiasing)
+        stage.setOrder (order);
+}
+
+template <typename SampleType>
+void AxisEngine<SampleType>::setTempoSync (bool shouldSync, double beatsPerCycle)
+{
+    tempoSync = shouldSync;
+    syncBeatsPerCycle = juce::jmax (0.25, beatsPerCycle);
+}
+
+template <typename SampleType>
+void AxisEngine<SampleType>::setTransportPosition (double ppqPosition, double bpm)
+{
+    syncPpq = ppqPosition;
+    syncBpm = juce::jlimit (1.0, 999.0, bpm);
+    syncPositionPending = true;
+}
+
+template <typename SampleType>
+void AxisEngine<SampleType>::setNumFilters (int newNumFilters)
+{
+    newNumFilters = juce::jlimit (2, maxFilters, juce::nextPowerOfTwo (newNumFilters));
+
+    if (newNumFilters == numFilters)
+        return;
+
+    // Filters coming into the bank start from rest
+    for (int k = numFilters; k < newNumFilters; ++k)
+        resetFilter (k);
+
+    numFilters = newNumFilters;
+    updateFilterLayout();
+
+    // The R lanes moved with the bank size
+    if (stereoLanes)
+        seedRightLanes();
+}
+
+template <typename SampleType>
+void AxisEngine<SampleType>::setStereoDecorrelation (bool shouldDecorrelate)
+{
+    decorrelate = shouldDecorrelate;
+    updateLanes();
+}
+
+template <typename SampleType>
+void AxisEngine<SampleType>::updateLanes()
+{
+    const bool shouldUseStereoLanes = decorrelate && numOutputs == 2;
+
+    if (shouldUseStereoLanes == stereoLanes)
+        return;
+
+    stereoLanes = shouldUseStereoLanes;
+
+    if (stereoLanes)
+    {
+        // The R side starts where the shared bank is, then drifts apart
+        phaseAR = phaseA;
+        phaseBR = phaseB;
+        driftAR = driftA;
+        driftBR = driftB;
+        driftTargetAR = driftTargetA;
+        driftTargetBR = driftTargetB;
+        sourceAntialiasing[1] = sourceAntialiasing[0];
+
+        seedRightLanes();
+    }
+}
+
+template <typename SampleType>
+void AxisEngine<SampleType>::seedRightLanes()
+{
+    const auto n = (size_t) numFilters;
+
+    for (size_t k = 0; k < n; ++k)
+    {
+        smoothedFc[n + k] = smoothedFc[k];
+        targetFc[n + k]   = targetFc[k];
+        crossMod[n + k]   = crossMod[k];
+        R2[n + k]         = R2[k];
+        s1[n + k]         = s1[k];
+        s2[n + k]         = s2[k];
+        weights[n + k].fill (0.0f);
+    }
+
+    updateFilterCoefficients();
+}
 
-static inline float diodeClip (float x, float drive, float asym)
+template <typename SampleType>
+void AxisEngine<SampleType>::updateFilterLayout()
 {
-    float kPos = drive;
-    float kNeg = drive * asym;
+    bankGain = std::sqrt (2.0f / (float) numFilters);
+
+    for (size_t k = 0; k < (size_t) numFilters; ++k)
+    {
+        // Two filters keep the original quarter-cycle offset, larger banks
+        // are spread evenly around the axis
+        sweepOffset[k] = numFilters == 2 ? k * AxisPhase::quarter64
+                                         : AxisPhase::fromCycles ((double) k / numFilters);
+        panOffset[k]   = AxisPhase::fromCycles ((double) k / numFilters);
+    }
+}
+
+template <typename SampleType>
+void AxisEngine<SampleType>::setOutputLayout (const juce::AudioChannelSet& layout)
+{
+    const int numChannels = juce::jlimit (1, maxOutputs, layout.size());
+
+    numOutputs   = numChannels;
+    numHarmonics = 1;
+
+    omniWeight.fill (0.0f);
+    pairGainL.fill (0.0f);
+    pairGainR.fill (0.0f);
 
-    if (x >= 0.0f)
-        return x / (1.0f + kPos * std::abs (x));
+    for (int j = 0; j < maxHarmonics; ++j)
+    {
+        sinWeight[(size_t) j].fill (0.0f);
+        cosWeight[(size_t) j].fill (0.0f);
+    }
+
+    const int order = layout.getAmbisonicOrder();
+
+    if (numChannels == 1)
+    {
+        // Mono collapse: only the R weights of the stereo crossfade (the
+        // channel a mono bus used to get), one filter sum / shaper channel
+        omniWeight[0] = 0.5f;
+        sinWeight[0][0] = -0.5f;
+
+        pairGainR[0] = 1.0f;
+    }
+    else if (numChannels == 2)
+    {
+        // The original crossfade: R half a cycle behind L
+        omniWeight[0] = omniWeight[1] = 0.5f;
+        sinWeight[0][0] =  0.5f;
+        sinWeight[0][1] = -0.5f;
+
+        pairGainL[0] = pairGainR[1] = 1.0f;
+    }
+    else if (order >= 1)
+    {
+        // ACN / SN3D, each filter a source circling on the horizon. Values are
+        // N_l^|m| * P_l^|m| (0); zonal (m = 0) terms are constant there. Halved
+        // so W sits at the stereo channels' level.
+        static constexpr float horizon[maxHarmonics + 1][maxHarmonics + 1]
+        {
+            { 1.0f },
+            { 0.0f,  1.0f },
+            { -0.5f, 0.0f,        0.8660254f },
+            { 0.0f,  -0.6123724f, 0.0f,       0.7905694f }
+        };
+
+        numHarmonics = juce::jmin (order, maxHarmonics);
+
+        for (int l = 0; l <= numHarmonics; ++l)
+        {
+            for (int m = -l; m <= l; ++m)
+            {
+                const auto c = (size_t) (l * l + l + m);
+
+                if (c >= (size_t) numOutputs)
+                    continue;
+
+                const float k = 0.5f * horizon[l][std::abs (m)];
+
+                if (m == 0)
+                    omniWeight[c] = k;
+                else if (m > 0)
+                    cosWeight[(size_t) m - 1][c] = k;
+                else
+                    sinWeight[(size_t) -m - 1][c] = k;
+            }
+        }
+
+        // Stereo-only stages: L / R as mid (W) and side (Y)
+        pairGainL[0] = pairGainR[0] = 0.5f;
+        pairGainL[1] = 0.5f;
+        pairGainR[1] = -0.5f;
+    }
     else
-        return x / (1.0f + kNeg * std::abs (x));
+    {
+        // Speakers by azimuth (degrees, clockwise from front); LFE stays silent
+        auto getAzimuth = [] (juce::AudioChannelSet::ChannelType type) -> std::optional<float>
+        {
+            using CS = juce::AudioChannelSet;
+
+            switch (type)
+            {
+                case CS::left:               return -30.0f;
+                case CS::right:              return  30.0f;
+                case CS::centre:             return   0.0f;
+                case CS::leftCentre:         return -15.0f;
+                case CS::rightCentre:        return  15.0f;
+                case CS::wideLeft:           return -60.0f;
+                case CS::wideRight:          return  60.0f;
+                case CS::leftSurroundSide:   return -90.0f;
+                case CS::rightSurroundSide:  return  90.0f;
+                case CS::leftSurround:       return -110.0f;
+                case CS::rightSurround:      return  110.0f;
+                case CS::leftSurroundRear:   return -150.0f;
+                case CS::rightSurroundRear:  return  150.0f;
+                case CS::centreSurround:     return  180.0f;
+                case CS::topFrontLeft:       return -45.0f;
+                case CS::topFrontCentre:     return   0.0f;
+                case CS::topFrontRight:      return  45.0f;
+                case CS::topSideLeft:        return -90.0f;
+                case CS::topSideRight:       return  90.0f;
+                case CS::topRearLeft:        return -135.0f;
+                case CS::topRearCentre:      return  180.0f;
+                case CS::topRearRight:       return  135.0f;
+                case CS::LFE:
+                case CS::LFE2:               return std::nullopt;
+                default:                     return 0.0f;
+            }
+        };
+
+        int numRing = 0;
+
+        for (int c = 0; c < numChannels; ++c)
+            if (getAzimuth (layout.getTypeOfChannel (c)).has_value())
+                ++numRing;
+
+        const float ringGain = std::sqrt (2.0f / (float) juce::jmax (1, numRing));
+
+        for (int c = 0; c < numChannels; ++c)
+        {
+            const auto azimuth = getAzimuth (layout.getTypeOfChannel (c));
+
+            if (! azimuth.has_value())
+                continue;
+
+            // 0.5 + 0.5 * sin (t + phi), expanded into sin t / cos t terms
+            const float phi = juce::degreesToRadians (*azimuth);
+            const auto ch = (size_t) c;
+
+            omniWeight[ch]   = 0.5f * ringGain;
+            sinWeight[0][ch] = 0.5f * ringGain * std::cos (phi);
+            cosWeight[0][ch] = 0.5f * ringGain * std::sin (phi);
+
+            // Constant-power pan of L / R by the speaker's side
+            const float side = std::sin (phi);
+            pairGainL[ch] = std::sqrt (0.5f * (1.0f - side));
+            pairGainR[ch] = std::sqrt (0.5f * (1.0f + side));
+        }
+    }
+
+    needsCosine = numHarmonics > 1
+               || std::any_of (cosWeight[0].begin(), cosWeight[0].end(), [] (float w) { return std::abs (w) > 1.0e-6f; });
+
+    updateLanes();
 }
 
+template <typename SampleType>
+void AxisEngine<SampleType>::updateRotationWeights (size_t k, float width)
+{
+    const auto angle = spectralPhase + panOffset[k];
+
+    // sin / cos of the harmonics by angle addition from the fundamental
+    std::array<float, maxHarmonics> sinH {}, cosH {};
+    sinH[0] = AxisPhase::sine<float> (angle);
+
+    if (needsCosine)
+        cosH[0] = AxisPhase::sine<float> (angle + AxisPhase::quarter64);
+
+    for (size_t j = 1; j < (size_t) numHarmonics; ++j)
+    {
+        sinH[j] = sinH[j - 1] * cosH[0] + cosH[j - 1] * sinH[0];
+        cosH[j] = cosH[j - 1] * cosH[0] - sinH[j - 1] * sinH[0];
+    }
+
+    // Vectorised across channels
+    auto& w = weights[k];
+    const auto numCh = (size_t) numOutputs;
+
+    for (size_t c = 0; c < numCh; ++c)
+        w[c] = omniWeight[c];
+
+    for (size_t j = 0; j < (size_t) numHarmonics; ++j)
+    {
+        const float s = width * sinH[j];
 
-void AxisEngine::process (juce::AudioBuffer<float>& buffer)
+        for (size_t c = 0; c < numCh; ++c)
+            w[c] += sinWeight[j][c] * s;
+
+        if (needsCosine)
+        {
+            const float co = width * cosH[j];
+
+            for (size_t c = 0; c < numCh; ++c)
+                w[c] += cosWeight[j][c] * co;
+        }
+    }
+
+    for (size_t c = 0; c < numCh; ++c)
+        w[c] *= bankGain;
+}
+
+template <typename SampleType>
+void AxisEngine<SampleType>::downmixToPair (int numSamples)
 {
-    buffer.clear();
+    auto* pairL = pairBuffer.getWritePointer (0);
+    auto* pairR = pairBuffer.getWritePointer (1);
 
-    const int numSamples = buffer.getNumSamples();
-    const int numCh      = buffer.getNumChannels();
+    juce::FloatVectorOperations::clear (pairL, numSamples);
+    juce::FloatVectorOperations::clear (pairR, numSamples);
+
+    for (int c = 0; c < numOutputs; ++c)
+    {
+        const auto* src = filterBuffer.getReadPointer (c);
+        const auto gl = (SampleType) pairGainL[(size_t) c];
+        const auto gr = (SampleType) pairGainR[(size_t) c];
+
+        if (gl != 0)
+            juce::FloatVectorOperations::addWithMultiply (pairL, src, gl, numSamples);
+
+        if (gr != 0)
+            juce::FloatVectorOperations::addWithMultiply (pairR, src, gr, numSamples);
+    }
+}
 
-    auto* left  = buffer.getWritePointer (0);
-    auto* right = buffer.getWritePointer (numCh > 1 ? 1 : 0);
+template <typename SampleType>
+void AxisEngine<SampleType>::spreadPair (int channelOffset, int numSamples, bool replace)
+{
+    const auto* pairL = pairBuffer.getReadPointer (channelOffset);
+    const auto* pairR = pairBuffer.getReadPointer (channelOffset + 1);
+
+    for (int c = 0; c < numOutputs; ++c)
+    {
+        auto* dst = filterBuffer.getWritePointer (c);
+
+        if (replace)
+            juce::FloatVectorOperations::clear (dst, numSamples);
+
+        const auto gl = (SampleType) pairGainL[(size_t) c];
+        const auto gr = (SampleType) pairGainR[(size_t) c];
+
+        if (gl != 0)
+            juce::FloatVectorOperations::addWithMultiply (dst, pairL, gl, numSamples);
+
+        if (gr != 0)
+            juce::FloatVectorOperations::addWithMultiply (dst, pairR, gr, numSamples);
+    }
+}
+
+template <typename SampleType>
+void AxisEngine<SampleType>::resetFilter (int index)
+{
+    const auto k = (size_t) index;
+
+    smoothedFc[k] = targetFc[k] = (k & 1) == 0 ? 400.0f : 600.0f;
+    crossMod[k] = 0.0f;
+    weights[k].fill (0.0f);
+    s1[k] = s2[k] = 0;
+}
+
+template <typename SampleType>
+void AxisEngine<SampleType>::updateFilterCoefficients()
+{
+    // Runs every control tick (every sample at controlInterval 1) for every
+    // lane, so the prewarp uses the rational tan rather than std::tan
+    const auto wScale = (SampleType) (juce::MathConstants<double>::pi / sr);
+    const auto wLimit = (SampleType) (0.49 * juce::MathConstants<double>::pi);
+
+    for (size_t k = 0; k < (size_t) getNumLanes(); ++k)
+    {
+        g[k] = AxisMath::tan (juce::jmin ((SampleType) smoothedFc[k] * wScale, wLimit));
+        h[k] = (SampleType) 1 / ((SampleType) 1 + R2[k] * g[k] + g[k] * g[k]);
+    }
+}
+
+template <typename SampleType>
+void AxisEngine<SampleType>::setMode (int newMode)
+{
+    newMode = juce::jlimit ((int) filterMode, (int) spectralMode, newMode);
+
+    if (newMode == mode)
+        return;
+
+    mode = newMode;
+    spectralRotator.reset();
+}
+
+template <typename SampleType>
+void AxisEngine<SampleType>::setSpectralResolution (int sizeIndex, int overlapIndex)
+{
+    spectralRotator.setResolution (sizeIndex, overlapIndex);
+}
+
+template <typename SampleType>
+void AxisEngine<SampleType>::setModalModes (int numModes)
+{
+    modalBody.setNumModes (numModes);
+}
+
+template <typename SampleType>
+void AxisEngine<SampleType>::setModalMix (float mix)
+{
+    modalBody.setMix (mix);
+}
+
+template <typename SampleType>
+void AxisEngine<SampleType>::setControlInterval (int numSamples)
+{
+    controlInterval = juce::jmax (1, numSamples);
+    controlCountdown = juce::jmin (controlCountdown, controlInterval);
+}
+
+template <typename SampleType>
+void AxisEngine<SampleType>::setFastShapers (bool shouldUseApproximations)
+{
+    fastShapers = shouldUseApproximations;
+}
+
+template <typename SampleType>
+float AxisEngine<SampleType>::getLatencySamples() const
+{
+    const auto& source = sourceOversampling[(size_t) oversamplingIndex];
+    const auto& output = outputOversampling[(size_t) oversamplingIndex];
+
+    float latency = mode == spectralMode ? (float) spectralRotator.getLatencySamples() : 0.0f;
+
+    if (source != nullptr)
+        latency += (float) (source->getLatencyInSamples() + output->getLatencyInSamples());
+
+    return latency;
+}
+
+
+template <typename SampleType>
+static inline SampleType diodeClip (SampleType x, float drive, float asym)
+{
+    SampleType kPos = drive;
+    SampleType kNeg = drive * asym;
+
+    if (x >= 0)
+        return x / (1 + kPos * std::abs (x));
+    else
+        return x / (1 + kNeg * std::abs (x));
+}
+
+template <typename SampleType>
+static inline SampleType shaperTanh (SampleType x, bool fast)
+{
+    return fast ? AxisMath::tanh (x) : std::tanh (x);
+}
+
+
+template <typename SampleType>
+typename AxisEngine<SampleType>::Ramp AxisEngine<SampleType>::rampTo (float& last, float target, int numSamples) const noexcept
+{
+    const float start = settleRamps ? target : last;
+    last = target;
+
+    // Reaches the target on the block's last sample
+    return { start, (target - start) / (float) juce::jmax (1, numSamples) };
+}
+
+template <typename SampleType>
+typename AxisEngine<SampleType>::BlockParams AxisEngine<SampleType>::updateBlockParams (int numSamples)
+{
+    BlockParams p;
 
     // ---- Block-level mappings (polish: avoid recalculating per sample) ----
 
     // WEAR drift settings
-    const float driftAmount   = juce::jmap (wear, 0.0f, 0.15f);
-    const float driftSpeedHz  = juce::jmap (wear, 0.1f, 2.0f);
-    const int   driftInterval = juce::jmax (1, (int) (sr / driftSpeedHz));
-    
+    p.driftAmount = juce::jmap (wear, 0.0f, 0.15f);
+    const float driftSpeedHz = juce::jmap (wear, 0.1f, 2.0f);
+    p.driftInterval = juce::jmax (1, (int) (sr / driftSpeedHz));
+
     // Torque: MASS controls inertia of rotation
     const float torqueSpeed = juce::jmap (mass, 0.2f, 0.01f); // low mass = fast response
 
@@ -97,33 +696,36 @@ void AxisEngine::process (juce::AudioBuffer<float>& buffer)
 
     // ROTATION + MASS: speed & depth
     const float rotationRateBase = juce::jmap (rotationSmoothed, 0.0005f, 0.03f);
-    const float rotationRate     = rotationRateBase * juce::jmap (mass, 1.0f, 0.35f);
+    const float rotationRate = rotationRateBase * juce::jmap (mass, 1.0f, 0.35f);
+    p.rotationIncrement = tempoSync ? AxisPhase::increment64 (syncBpm / 60.0 / syncBeatsPerCycle, sr)
+                                    : AxisPhase::increment64 (rotationRate, sr);
 
     const float sweepOctavesBase = juce::jmap (rotationSmoothed, 0.2f, 3.0f);
-    const float sweepOctaves     = sweepOctavesBase * juce::jmap (mass, 1.0f, 0.45f);
+    p.sweepOctaves = sweepOctavesBase * juce::jmap (mass, 1.0f, 0.45f) * juce::jmax (0.0f, 1.0f + modSweep);
 
     // BODY: spectral center bias
-    const float baseCentre = juce::jmap (body, 80.0f, 1200.0f);
+    p.baseCentre = juce::jmap (body, 80.0f, 1200.0f) * std::exp2 (modCentre);
 
-    // Phase relationship between the two rotating filters
-    const float phaseOffset = juce::MathConstants<float>::pi * 0.5f;
+    // Small stereo width at low ROTATION
+    p.width = juce::jlimit (0.0f, 1.0f, juce::jmap (rotationSmoothed, 0.05f, 1.0f) + modWidth);
 
     // MASS inertia smoothing (1-pole)
     const float tauSeconds = juce::jmap (mass, 0.02f, 0.60f);
-    const float a = std::exp (-1.0f / (tauSeconds * (float) sr));
+    p.a = std::exp (-1.0f / (tauSeconds * (float) sr));
 
     // BODY as topology control
     const float bodyLow  = juce::jlimit (0.0f, 1.0f, body * 3.0f);          // 0..1
     const float bodyMid  = juce::jlimit (0.0f, 1.0f, body * 3.0f - 1.0f);   // 0..1
     const float bodyHigh = juce::jlimit (0.0f, 1.0f, body * 3.0f - 2.0f);   // 0..1
-    
+    p.bodyHigh = bodyHigh;
+
     // Base resonance per regime
     const float resLow  = juce::jmap (bodyLow,  0.25f, 1.0f);
     const float resMid  = juce::jmap (bodyMid,  1.0f, 3.5f);
     const float resHigh = juce::jmap (bodyHigh, 3.5f, 6.5f); // LOWER than before
-    
+
     // BODY high enables cross-mod, MASS limits it
-    const float crossAmount = bodyHigh * juce::jmap (mass, 0.4f, 0.1f);
+    p.crossAmount = bodyHigh * juce::jmap (mass, 0.4f, 0.1f);
 
     // Crossfade regimes
     float resonance =
@@ -134,181 +736,507 @@ void AxisEngine::process (juce::AudioBuffer<float>& buffer)
     // LOAD safety scaling
     resonance *= juce::jmap (load, 1.0f, 0.65f);
 
-    // BODY high creates asymmetrical Q between filters
+    // BODY high creates asymmetrical Q between alternate filters
     const float qSkew = bodyHigh * 0.35f;
 
-    filterA_L.setResonance (resonance * (1.0f + qSkew));
-    filterA_R.setResonance (resonance * (1.0f + qSkew));
-    filterB_L.setResonance (resonance * (1.0f - qSkew));
-    filterB_R.setResonance (resonance * (1.0f - qSkew));
+    for (size_t k = 0; k < (size_t) numFilters; ++k)
+        R2[k] = (SampleType) (1.0f / (resonance * ((k & 1) == 0 ? 1.0f + qSkew : 1.0f - qSkew)));
+
+    if (stereoLanes)
+        std::copy (R2.begin(), R2.begin() + numFilters, R2.begin() + numFilters);
 
-    // LOAD drive
+    updateFilterCoefficients();
+
+    // Folds + BODY high = stressed input (pre-filter)
+    p.foldAmount = 1.0f + load * 4.0f;
+    p.fold2      = 1.5f + body * 2.0f;
+    p.stress     = 1.0f + bodyHigh * 0.6f;
+
+    // LOAD drive, ramped across the block
     const float preGainDb = juce::jmap (load, 0.0f, 24.0f);
-    const float preGain   = juce::Decibels::decibelsToGain (preGainDb);
-    const float postTrim  = juce::jmap (load, 1.0f, 0.25f);
+    p.preGain  = rampTo (lastPreGain, juce::Decibels::decibelsToGain (preGainDb), numSamples);
+    p.postTrim = rampTo (lastPostTrim, juce::jmap (load, 1.0f, 0.25f), numSamples);
 
     // MASS: sub amount, damping mix, damping filter coeff
-    const float subGain  = juce::jmap (mass, 0.0f, 0.35f);
-    const float dampMix  = juce::jmap (mass, 0.0f, 0.65f);
+    p.subGain = juce::jmap (mass, 0.0f, 0.35f);
+    p.dampMix = juce::jmap (mass, 0.0f, 0.65f);
 
     const float dampCut = juce::jmap (mass, 10000.0f, 1200.0f);
     const float x = std::exp (-juce::MathConstants<float>::twoPi * dampCut / (float) sr);
-    const float g = 1.0f - x;
+    p.g = 1.0f - x;
 
     // WEAR: oscillator instability + post saturation
-    const float instability = juce::jmap (wear, 0.0f, 0.003f);
-    const float wearDrive   = juce::jmap (wear, 1.0f, 3.5f);
+    p.instability = juce::jmap (wear, 0.0f, 0.003f);
+    p.diodeDrive  = rampTo (lastDiodeDrive, juce::jmap (wear, 0.5f, 6.0f), numSamples);
+    p.asym        = juce::jmap (bodyHigh, 1.0f, 2.2f);
+
+    settleRamps = false;
+
+    // Mid grit amount
+    p.gritAmount = body * 0.02f;
+
+    return p;
+}
+
+
+template <typename SampleType>
+void AxisEngine<SampleType>::renderOscillators (const BlockParams& p, int startSample, int numSamples)
+{
+    auto* sineAOut = sourceBuffer.getWritePointer (0);
+    auto* sineBOut = sourceBuffer.getWritePointer (1);
+    auto* subOut   = sourceBuffer.getWritePointer (2);
+
+    auto* driftAOut = driftBuffer.getWritePointer (0);
+    auto* driftBOut = driftBuffer.getWritePointer (1);
+
+    // Phase increments in 2^32 units per sample; drift only scales them. The
+    // float drift still runs for the filter cutoffs (driftBuffer).
+    const double incrementA  = baseFreq / sr * AxisPhase::cycle32;
+    const double incrementB  = incrementA * 1.01;
+    const auto incrementSub  = AxisPhase::increment32 (baseFreq * 0.5, sr);
+
+    AxisPhase::DriftingIncrement stepA (incrementA,  p.instability, driftA, driftTargetA);
+    AxisPhase::DriftingIncrement stepB (incrementB, -p.instability, driftB, driftTargetB);
 
-    // ---- Sample loop ----
     for (int i = 0; i < numSamples; ++i)
     {
         // Drift update (occasionally retarget, then smooth toward target)
-        if (i % driftInterval == 0)
+        if ((startSample + i) % p.driftInterval == 0)
         {
             driftTargetA = random.nextFloat() * 2.0f - 1.0f;
             driftTargetB = random.nextFloat() * 2.0f - 1.0f;
+
+            stepA.retarget (driftTargetA);
+            stepB.retarget (driftTargetB);
         }
 
         driftA += 0.0005f * (driftTargetA - driftA);
         driftB += 0.0005f * (driftTargetB - driftB);
 
-        // Spectral rotation phase
-        spectralPhase += rotationRate / (float) sr;
-        if (spectralPhase > 1.0f)
-            spectralPhase -= 1.0f;
+        driftAOut[i] = driftA;
+        driftBOut[i] = driftB;
 
-        const float phi = spectralPhase * juce::MathConstants<float>::twoPi;
+        // ----- Oscillator stack -----
+        phaseA += stepA.next();
+        phaseB += stepB.next();
 
-        // Rotating modulators
-        const float modA = std::sin (phi);
-        const float modB = std::sin (phi + phaseOffset);
+        sineAOut[i] = AxisPhase::sine<SampleType> (phaseA);
+        sineBOut[i] = AxisPhase::sine<SampleType> (phaseB);
 
-        // Exponential frequency sweep (use exp2 for 2^x)
-        float fcA = baseCentre * std::exp2 (modA * sweepOctaves);
-        float fcB = baseCentre * std::exp2 (modB * sweepOctaves);
+        // Sub layer (MASS)
+        phaseSub += incrementSub;
 
-        // WEAR drift on filter centers
-        fcA *= (1.0f + driftA * driftAmount);
-        fcB *= (1.0f + driftB * driftAmount);
+        subOut[i] = AxisPhase::sine<SampleType> (phaseSub);
+    }
 
-        // Safety clamp
-        fcA = juce::jlimit (20.0f, 18000.0f, fcA);
-        fcB = juce::jlimit (20.0f, 18000.0f, fcB);
+    if (! stereoLanes)
+        return;
 
-        // MASS inertia smoothing of cutoff
-        smoothedFcA = a * smoothedFcA + (1.0f - a) * fcA;
-        smoothedFcB = a * smoothedFcB + (1.0f - a) * fcB;
+    // Decorrelated R side: own drift, A / B detuned apart from L (sub shared)
+    auto* sineAROut  = sourceBuffer.getWritePointer (3);
+    auto* sineBROut  = sourceBuffer.getWritePointer (4);
+    auto* driftAROut = driftBuffer.getWritePointer (2);
+    auto* driftBROut = driftBuffer.getWritePointer (3);
 
-        filterA_L.setCutoffFrequency (smoothedFcA);
-        filterA_R.setCutoffFrequency (smoothedFcA);
-        filterB_L.setCutoffFrequency (smoothedFcB);
-        filterB_R.setCutoffFrequency (smoothedFcB);
+    AxisPhase::DriftingIncrement stepAR (incrementA * (1.0 + stereoDetune),  p.instability, driftAR, driftTargetAR);
+    AxisPhase::DriftingIncrement stepBR (incrementB * (1.0 - stereoDetune), -p.instability, driftBR, driftTargetBR);
 
-        // ----- Oscillator stack -----
-        const float freqA = baseFreq * (1.0f + instability * driftA);
-        const float freqB = baseFreq * 1.01f * (1.0f - instability * driftB);
-        const float freqC = baseFreq * 0.5f;
+    for (int i = 0; i < numSamples; ++i)
+    {
+        if ((startSample + i) % p.driftInterval == 0)
+        {
+            driftTargetAR = randomR.nextFloat() * 2.0f - 1.0f;
+            driftTargetBR = randomR.nextFloat() * 2.0f - 1.0f;
 
-        phaseA += freqA / (float) sr;
-        phaseB += freqB / (float) sr;
-        phaseC += freqC / (float) sr;
+            stepAR.retarget (driftTargetAR);
+            stepBR.retarget (driftTargetBR);
+        }
 
-        phaseA -= (int) phaseA;
-        phaseB -= (int) phaseB;
-        phaseC -= (int) phaseC;
+        driftAR += 0.0005f * (driftTargetAR - driftAR);
+        driftBR += 0.0005f * (driftTargetBR - driftBR);
 
-        const float sineA = std::sin (juce::MathConstants<float>::twoPi * phaseA);
-        const float sineB = std::sin (juce::MathConstants<float>::twoPi * phaseB);
-        
-        // Soft wavefold
-        float foldAmount = 1.0f + load * 4.0f;  
-        float folded = std::tanh (sineA * foldAmount);
+        driftAROut[i] = driftAR;
+        driftBROut[i] = driftBR;
 
-        // Secondary fold
-        folded = std::tanh (folded * (1.5f + body * 2.0f));
+        phaseAR += stepAR.next();
+        phaseBR += stepBR.next();
 
-        float osc = (sineA * 0.3f) + (sineB * 0.2f) + (folded * 0.5f);
-        float grind = osc * std::abs(osc);
-        osc = juce::jmap (bodyHigh, osc, grind);
+        sineAROut[i] = AxisPhase::sine<SampleType> (phaseAR);
+        sineBROut[i] = AxisPhase::sine<SampleType> (phaseBR);
+    }
+}
 
+template <typename SampleType>
+void AxisEngine<SampleType>::shapeSource (const BlockParams& p, int startSample, int numSamples)
+{
+    // Folds, grind and LOAD drive run at the oversampled rate when enabled;
+    // the stressed result ends up in channel 0 (R side: channel 1) at the
+    // base rate.
+    auto block = juce::dsp::AudioBlock<SampleType> (sourceBuffer)
+                     .getSubsetChannelBlock (0, stereoLanes ? 5 : 3)
+                     .getSubBlock (0, (size_t) numSamples);
+    auto* oversampling = sourceOversampling[(size_t) oversamplingIndex].get();
 
-        // Sub layer (MASS)
-        phaseSub += (baseFreq * 0.5f) / (float) sr;
-        phaseSub -= (int) phaseSub;
+    auto shaped = oversampling != nullptr ? oversampling->processSamplesUp (block) : block;
+
+    auto* sineA = shaped.getChannelPointer (0);
+    auto* sineB = shaped.getChannelPointer (1);
+    auto* sub   = shaped.getChannelPointer (2);
+
+    // Oversampled sample i sits at base-rate position startSample + (i + 1) / factor
+    const float sampleSpacing = (float) numSamples / (float) shaped.getNumSamples();
 
-        const float sub = std::sin (juce::MathConstants<float>::twoPi * phaseSub);
-        osc += sub * subGain;
+    auto stress = [this, &p] (SampleType a, SampleType b, SampleType s, float preGain, float postTrim, size_t side)
+    {
+        auto shaper = [this, side] (int stage, SampleType x) -> SampleType
+        {
+            auto& adaa = sourceAntialiasing[side][(size_t) stage];
+
+            if (antialiasing > 0)
+                return (SampleType) adaa.process ((double) x);
+
+            // Keep the ADAA history current so turning it on doesn't click
+            adaa.push ((double) x);
+            return shaperTanh (x, fastShapers);
+        };
+
+        // Soft wavefold
+        SampleType folded = shaper (foldStage, a * p.foldAmount);
+
+        // Secondary fold
+        folded = shaper (fold2Stage, folded * p.fold2);
+
+        SampleType osc = (a * 0.3f) + (b * 0.2f) + (folded * 0.5f);
+        SampleType grind = osc * std::abs (osc);
+        osc = juce::jmap ((SampleType) p.bodyHigh, osc, grind);
+
+        osc += s * p.subGain;
 
         // LOAD drive + excitation
-        float driven = std::tanh (osc * preGain);
+        SampleType driven = shaper (driveStage, osc * preGain);
         driven *= postTrim;
-        
-        // BODY high = stressed input (pre-filter)
-        float stress = 1.0f + bodyHigh * 0.6f;
-        float stressed = std::tanh (driven * stress);
 
+        return shaper (stressStage, driven * p.stress);
+    };
+
+    if (stereoLanes)
+    {
+        const auto* sineAR = shaped.getChannelPointer (3);
+        const auto* sineBR = shaped.getChannelPointer (4);
+
+        // sineB is consumed before its slot takes the stressed R sample
+        for (size_t i = 0; i < shaped.getNumSamples(); ++i)
+        {
+            const float position = (float) startSample + (float) (i + 1) * sampleSpacing;
+            const float preGain  = p.preGain.at (position);
+            const float postTrim = p.postTrim.at (position);
+
+            const SampleType left = stress (sineA[i], sineB[i], sub[i], preGain, postTrim, 0);
+            sineB[i] = stress (sineAR[i], sineBR[i], sub[i], preGain, postTrim, 1);
+            sineA[i] = left;
+        }
+    }
+    else
+    {
+        for (size_t i = 0; i < shaped.getNumSamples(); ++i)
+        {
+            const float position = (float) startSample + (float) (i + 1) * sampleSpacing;
+            sineA[i] = stress (sineA[i], sineB[i], sub[i], p.preGain.at (position), p.postTrim.at (position), 0);
+        }
+    }
+
+    if (oversampling != nullptr)
+    {
+        auto stressed = block.getSubsetChannelBlock (0, stereoLanes ? 2 : 1);
+        oversampling->processSamplesDown (stressed);
+    }
+}
+
+template <typename SampleType>
+void AxisEngine<SampleType>::runFilterNetwork (const BlockParams& p, int numSamples)
+{
+    const auto* stressedIn  = sourceBuffer.getReadPointer (0);
+    const auto* stressedRIn = sourceBuffer.getReadPointer (1);
+    const auto* driftAIn    = driftBuffer.getReadPointer (0);
+    const auto* driftBIn    = driftBuffer.getReadPointer (1);
+    const auto* driftARIn   = driftBuffer.getReadPointer (2);
+    const auto* driftBRIn   = driftBuffer.getReadPointer (3);
+
+    std::array<SampleType*, maxOutputs> out {};
+    const auto numCh = (size_t) numOutputs;
+
+    for (size_t c = 0; c < numCh; ++c)
+        out[c] = filterBuffer.getWritePointer ((int) c);
+
+    const auto n = (size_t) numFilters;
+    const auto numLanes = (size_t) getNumLanes();
+
+    for (int i = 0; i < numSamples; ++i)
+    {
+        // Spectral rotation phase
+        spectralPhase += p.rotationIncrement;
+
+        const bool controlTick = --controlCountdown <= 0;
+
+        if (controlTick)
+        {
+            controlCountdown = controlInterval;
+
+            for (size_t k = 0; k < n; ++k)
+            {
+                // Rotating modulator -> exponential frequency sweep
+                const float mod = AxisPhase::sine<float> (spectralPhase + sweepOffset[k]);
+                const float sweptFc = p.baseCentre * std::exp2 (mod * p.sweepOctaves);
+
+                // WEAR drift on filter centers (alternating A / B drift)
+                const float fc = sweptFc * (1.0f + ((k & 1) == 0 ? driftAIn[i] : driftBIn[i]) * p.driftAmount);
+
+                // Safety clamp
+                targetFc[k] = juce::jlimit (20.0f, 18000.0f, fc);
+
+                // Spectral rotation weights around the output layout (with two
+                // filters in stereo this is the original A / B crossfade)
+                updateRotationWeights (k, p.width);
+
+                if (stereoLanes)
+                {
+                    // R lane: its own drift and a small cutoff offset; each
+                    // side's lanes only feed that side
+                    const float fcR = sweptFc * ((k & 1) == 0 ? stereoCutoffOffset : 1.0f / stereoCutoffOffset)
+                                    * (1.0f + ((k & 1) == 0 ? driftARIn[i] : driftBRIn[i]) * p.driftAmount);
+
+                    targetFc[n + k] = juce::jlimit (20.0f, 18000.0f, fcR);
+
+                    weights[n + k][0] = 0.0f;
+                    weights[n + k][1] = weights[k][1];
+                    weights[k][1] = 0.0f;
+                }
+            }
+        }
+
+        // MASS inertia smoothing of cutoff
+        for (size_t k = 0; k < numLanes; ++k)
+            smoothedFc[k] = p.a * smoothedFc[k] + (1.0f - p.a) * targetFc[k];
+
+        if (controlTick)
+            updateFilterCoefficients();
+
+        // ----- Filter network (TPT bandpass, vectorised across filters) -----
+        std::array<SampleType, maxOutputs> sum {};
+
+        auto runLanes = [&] (size_t begin, size_t end, SampleType stressed)
+        {
+            for (size_t k = begin; k < end; ++k)
+            {
+                const SampleType hp = h[k] * (stressed - s1[k] * (g[k] + R2[k]) - s2[k]);
+                const SampleType bp = hp * g[k] + s1[k];
 
-        // ----- Filter network -----
-        const float outA_L = filterA_L.processSample (0, stressed);
-        const float outA_R = filterA_R.processSample (0, stressed);
+                s1[k] = hp * g[k] + bp;
+                s2[k] += (SampleType) 2 * bp * g[k];
 
-        const float outB_L = filterB_L.processSample (0, stressed);
-        const float outB_R = filterB_R.processSample (0, stressed);
-        
-        // ----- Cross modulation between filters -----
+                // Smoothed energy for the cross modulation
+                crossMod[k] += 0.001f * ((float) std::abs (bp) - crossMod[k]);
 
-        float energyA = 0.5f * (std::abs (outA_L) + std::abs (outA_R));
-        float energyB = 0.5f * (std::abs (outB_L) + std::abs (outB_R));
+                for (size_t c = 0; c < numCh; ++c)
+                    sum[c] += bp * (SampleType) weights[k][c];
+            }
+        };
 
-        // Smoothing
-        crossModA += 0.001f * (energyA - crossModA);
-        crossModB += 0.001f * (energyB - crossModB);
+        runLanes (0, n, stressedIn[i]);
 
-        // Apply very small cutoff nudges
-        smoothedFcA *= (1.0f + crossAmount * crossModB);
-        smoothedFcB *= (1.0f + crossAmount * crossModA);
+        if (stereoLanes)
+            runLanes (n, numLanes, stressedRIn[i]);
+
+        // ----- Cross modulation: very small cutoff nudges around the ring -----
+        for (size_t first = 0; first < numLanes; first += n)
+        {
+            smoothedFc[first] *= (1.0f + p.crossAmount * crossMod[first + n - 1]);
+
+            for (size_t k = first + 1; k < first + n; ++k)
+                smoothedFc[k] *= (1.0f + p.crossAmount * crossMod[k - 1]);
+        }
 
         // Clamp safety
-        smoothedFcA = juce::jlimit (20.0f, 18000.0f, smoothedFcA);
-        smoothedFcB = juce::jlimit (20.0f, 18000.0f, smoothedFcB);
-        
-        // Stereo spectral rotation weight
-        float stereoPhase = spectralPhase * juce::MathConstants<float>::twoPi;
-
-        const float width = juce::jmap (rotationSmoothed, 0.05f, 1.0f); // small width at low ROTATION
-        float weightL = 0.5f + 0.5f * width * std::sin (stereoPhase);
-        float weightR = 0.5f + 0.5f * width * std::sin (stereoPhase + juce::MathConstants<float>::pi);
-        
-        weightL = juce::jlimit (0.0f, 1.0f, weightL);
-        weightR = juce::jlimit (0.0f, 1.0f, weightR);
-
-        // Crossfade between filter A and B per channel
-        float outL = outA_L * weightL + outB_L * (1.0f - weightL);
-        float outR = outA_R * weightR + outB_R * (1.0f - weightR);
-
-        // WEAR post saturation
-        float diodeDrive = juce::jmap (wear, 0.5f, 6.0f);
-        float asym       = juce::jmap (bodyHigh, 1.0f, 2.2f);
-
-        outL = diodeClip (outL, diodeDrive, asym);
-        outR = diodeClip (outR, diodeDrive, asym);
-
-        
-        // Mid grit (cheap nonlinearity) - adds texture without pitch
-        float grit = (outL * outL * outL) - outL; // odd harmonics
-        outL += grit * body * 0.02f;
-        grit = (outR * outR * outR) - outR;
-        outR += grit * body * 0.02f;
-        
-
-
-        // MASS damping (1 pole lowpass)
-        dampL += g * (outL - dampL);
-        dampR += g * (outR - dampR);
-
-        // Blend damp/raw
-        left[i]  = outL * (1.0f - dampMix) + dampL * dampMix;
-        right[i] = outR * (1.0f - dampMix) + dampR * dampMix;
+        for (size_t k = 0; k < numLanes; ++k)
+            smoothedFc[k] = juce::jlimit (20.0f, 18000.0f, smoothedFc[k]);
+
+        for (size_t c = 0; c < numCh; ++c)
+            out[c][i] = sum[c];
     }
 }
 
+template <typename SampleType>
+void AxisEngine<SampleType>::runSpectralRotation (const BlockParams& p, int numSamples)
+{
+    // The rotation LFO position is the rotation itself: one LFO cycle turns
+    // the band once; R runs a quarter turn ahead, scaled by the stereo width
+    const double cycles = AxisPhase::toCycles (spectralPhase);
+    spectralRotator.setRotation ((float) cycles, (float) (cycles + 0.25 * p.width));
+
+    spectralPhase += p.rotationIncrement * (juce::uint64) numSamples;
+
+    // Stereo straight into the output, other layouts through the pair
+    auto& target = numOutputs == 2 ? filterBuffer : pairBuffer;
+
+    spectralRotator.process (sourceBuffer.getReadPointer (0),
+                             target.getWritePointer (0),
+                             target.getWritePointer (1),
+                             numSamples);
+
+    if (numOutputs != 2)
+        spreadPair (0, numSamples, true);
+}
+
+template <typename SampleType>
+void AxisEngine<SampleType>::shapeOutput (const BlockParams& p, int startSample, int numSamples)
+{
+    // WEAR diode saturation + grit, oversampled like shapeSource
+    auto block = juce::dsp::AudioBlock<SampleType> (filterBuffer).getSubBlock (0, (size_t) numSamples);
+    auto* oversampling = outputOversampling[(size_t) oversamplingIndex].get();
+
+    auto shaped = oversampling != nullptr ? oversampling->processSamplesUp (block) : block;
+
+    const float sampleSpacing = (float) numSamples / (float) shaped.getNumSamples();
+
+    for (size_t ch = 0; ch < shaped.getNumChannels(); ++ch)
+    {
+        auto* data = shaped.getChannelPointer (ch);
+        auto& adaa = outputAntialiasing[ch];
+
+        // diodeClip (x, k, asym) is clip (k x) / k for the unit-drive curve, so
+        // the antialiased stage keeps one shape while the drive ramps
+        if (antialiasing > 0)
+            adaa.setShape ({ 1.0, (double) p.asym });
+
+        for (size_t i = 0; i < shaped.getNumSamples(); ++i)
+        {
+            const float drive = p.diodeDrive.at ((float) startSample + (float) (i + 1) * sampleSpacing);
+            SampleType out;
+
+            if (antialiasing > 0)
+            {
+                out = (SampleType) (adaa.process ((double) (data[i] * drive)) / drive);
+            }
+            else
+            {
+                adaa.push ((double) (data[i] * drive));
+                out = diodeClip (data[i], drive, p.asym);
+            }
+
+            // Mid grit (cheap nonlinearity) - adds texture without pitch
+            SampleType grit = (out * out * out) - out; // odd harmonics
+            data[i] = out + grit * p.gritAmount;
+        }
+    }
+
+    if (oversampling != nullptr)
+        oversampling->processSamplesDown (block);
+}
+
+
+template <typename SampleType>
+void AxisEngine<SampleType>::process (juce::AudioBuffer<SampleType>& buffer)
+{
+    buffer.clear();
+
+    const int numSamples = buffer.getNumSamples();
+    const int numOutCh   = juce::jmin (buffer.getNumChannels(), numOutputs);
+
+    const auto p = updateBlockParams (numSamples);
+
+    // Locked to the play head: the phase at the block start comes from ppq,
+    // then advances sample by sample with the tempo increment
+    if (tempoSync && syncPositionPending)
+        spectralPhase = AxisPhase::fromCycles (syncPpq / syncBeatsPerCycle);
+
+    syncPositionPending = false;
+
+    // No-op unless BODY / MASS moved
+    modalBody.setShape (body, mass);
+
+    // Staged processing, one chunk of at most maxBlock samples at a time:
+    // oscillators -> (oversampled) folds/drive -> filter network (or spectral
+    // rotation) at base rate -> modal body -> (oversampled) post saturation -> damping
+    for (int start = 0; start < numSamples; start += maxBlock)
+    {
+        const int num = juce::jmin (maxBlock, numSamples - start);
+
+        renderOscillators (p, start, num);
+        shapeSource (p, start, num);
+
+        if (mode == spectralMode)
+            runSpectralRotation (p, num);
+        else
+            runFilterNetwork (p, num);
+
+        if (numOutputs == 2)
+        {
+            modalBody.process (filterBuffer.getWritePointer (0), filterBuffer.getWritePointer (1), num);
+        }
+        else if (modalBody.isActive())
+        {
+            // Resonate the stereo projection, then spread only the added
+            // resonance back over the layout
+            downmixToPair (num);
+
+            for (int ch = 0; ch < 2; ++ch)
+                pairBuffer.copyFrom (ch + 2, 0, pairBuffer, ch, 0, num);
+
+            modalBody.process (pairBuffer.getWritePointer (0), pairBuffer.getWritePointer (1), num);
+
+            for (int ch = 0; ch < 2; ++ch)
+                juce::FloatVectorOperations::subtract (pairBuffer.getWritePointer (ch),
+                                                       pairBuffer.getReadPointer (ch + 2), num);
+
+            spreadPair (0, num, false);
+        }
+
+        shapeOutput (p, start, num);
+
+        for (int ch = 0; ch < numOutCh; ++ch)
+        {
+            const auto* out = filterBuffer.getReadPointer (ch);
+            auto* dst = buffer.getWritePointer (ch, start);
+            auto& state = damp[(size_t) ch];
+
+            for (int i = 0; i < num; ++i)
+            {
+                // MASS damping (1 pole lowpass), blended with the raw signal
+                state += p.g * (out[i] - state);
+                dst[i] = out[i] * (1.0f - p.dampMix) + state * p.dampMix;
+            }
+        }
+    }
+
+    if (telemetry != nullptr)
+        publishTelemetry (buffer);
+}
+
+template <typename SampleType>
+void AxisEngine<SampleType>::publishTelemetry (const juce::AudioBuffer<SampleType>& buffer)
+{
+    auto& frame = telemetry->getWriteSlot();
+
+    const int numSamples = buffer.getNumSamples();
+
+    frame.rotationPhase = (float) AxisPhase::toCycles (spectralPhase);
+    frame.mode          = mode;
+    frame.numFilters    = mode == filterMode ? numFilters : 0;
+
+    // Bank (L side) only
+    std::copy (smoothedFc.begin(), smoothedFc.begin() + maxFilters, frame.centres.begin());
+    std::copy (crossMod.begin(), crossMod.begin() + maxFilters, frame.crossMod.begin());
+
+    frame.peakLeft  = (float) buffer.getMagnitude (0, 0, numSamples);
+    frame.peakRight = (float) buffer.getMagnitude (buffer.getNumChannels() > 1 ? 1 : 0, 0, numSamples);
+
+    telemetry->publish();
+}
+
+template class AxisEngine<float>;
+template class AxisEngine<double>;
+
+template void AxisEngine<float>::continueFrom (const AxisEngine<float>&);
+template void AxisEngine<float>::continueFrom (const AxisEngine<double>&);
+template void AxisEngine<double>::continueFrom (const AxisEngine<float>&);
+template void AxisEngine<double>::continueFrom (const AxisEngine<double>&);
@@ -1,11 +1,41 @@
 #pragma once
 #include <JuceHeader.h>
+#include "AxisModalBody.h"
+#include "AxisSpectralRotator.h"
+#include "AxisTelemetry.h"
+#include "AxisADAA.h"
 
+// Templated on the audio sample type (float / double). Macro mappings and
+// control signals stay in float; phases are fixed-point integers in both.
+template <typename SampleType>
 class AxisEngine
 {
 public:
-    void prepare (double sampleRate);
-    void process (juce::AudioBuffer<float>& buffer);
+    static constexpr int maxFilters = 16;
+    static constexpr int maxOutputs = 16;   // up to 3rd order ambisonics
+    static constexpr int maxLanes   = 2 * maxFilters;   // decorrelated stereo: L lanes, then R lanes
+
+    // Output bus layout: mono, stereo, discrete speaker layouts (the rotation
+    // travels around the speakers by azimuth) or ambisonics up to 3rd order
+    // (each filter encoded as a source circling the listener). Call before
+    // prepare(), which sizes the buffers for it.
+    void setOutputLayout (const juce::AudioChannelSet& layout);
+
+    void prepare (double sampleRate, int maxBlockSize = 512);
+
+    // Back to a deterministic start state (phases, filters, drift, seeds)
+    void reset();
+
+    // After reset(): picks up other's timeline (oscillator and rotation
+    // phases, drift, smoothed rotation) so this engine can take over from it
+    // under a crossfade. Filter state only carries over when the bank layout
+    // and the rate match; otherwise the filters start from rest.
+    template <typename OtherType>
+    void continueFrom (const AxisEngine<OtherType>& other);
+    void process (juce::AudioBuffer<SampleType>& buffer);
+
+    // Oscillator base frequency in Hz (the sub runs an octave below)
+    void setFrequency (float hz);
 
     void setRotation (float value);
     void setBody (float value);
@@ -13,13 +43,110 @@ public:
     void setMass (float value);
     void setWear (float value);
 
+    // Oversampling of the waveshaping stages only: 0 = 1x, 1 = 2x, 2 = 4x
+    void setOversampling (int factorIndex);
+
+    // Antiderivative anti-aliasing of the tanh folds / LOAD drive and the
+    // WEAR diode clip: 0 = off, 1 = first order, 2 = second order. Runs at
+    // the oversampled rate when both are on.
+    void setAntialiasing (int order);
+    float getLatencySamples() const;
+
+    // Tempo sync: the rotation completes one cycle every beatsPerCycle beats
+    void setTempoSync (bool shouldSync, double beatsPerCycle);
+
+    // Host position at the start of the next process() call. When synced the
+    // rotation phase is derived from it, so every pass renders identically.
+    void setTransportPosition (double ppqPosition, double bpm);
+
+    // Size of the rotating bandpass bank: 2 (classic pair), 4, 8 or 16
+    void setNumFilters (int newNumFilters);
+
+    // Decorrelated stereo: L and R get their own filter lanes, oscillators
+    // (slightly detuned), drift and cutoff offsets instead of sharing one
+    // bank. Stereo outputs only; other layouts keep the shared bank.
+    void setStereoDecorrelation (bool shouldDecorrelate);
+
+    // Engine mode: the rotating filter bank, or STFT rotation of the spectrum
+    enum Mode { filterMode = 0, spectralMode };
+
+    void setMode (int newMode);
+    void setSpectralResolution (int sizeIndex, int overlapIndex);
+
+    // Modal body stage after the filter network: 0 modes = off
+    void setModalModes (int numModes);
+    void setModalMix (float mix);
+
+    // Modulation of internal mappings (see AxisModMatrix): filter centre in
+    // octaves, relative sweep depth, stereo width offset; 0 = unmodulated
+    void setInternalModulation (float centreOctaves, float sweepAmount, float widthOffset) noexcept;
+
+    // Editor telemetry, published once per process() call (nullptr = off)
+    void setTelemetry (AxisTelemetry* destination) noexcept   { telemetry = destination; }
+
+    // Quality tiers (see AxisQualityGovernor)
+    void setControlInterval (int numSamples);
+    void setFastShapers (bool shouldUseApproximations);
+
 private:
+    template <typename> friend class AxisEngine;
+
+    // A block value that moves linearly across the block, from where the
+    // previous block left it: at (n) is its value after n base-rate samples
+    struct Ramp
+    {
+        float start, step;
+
+        float at (float position) const noexcept   { return start + step * position; }
+    };
+
+    // Block-level mappings shared by the processing stages
+    struct BlockParams
+    {
+        float driftAmount, instability;
+        int   driftInterval;
+        juce::uint64 rotationIncrement;
+        float sweepOctaves, baseCentre, width;
+        float a, crossAmount;
+        float bodyHigh, foldAmount, fold2, stress;
+        Ramp preGain, postTrim;
+        float subGain;
+        Ramp diodeDrive;
+        float asym, gritAmount;
+        float dampMix, g;
+    };
+
+    BlockParams updateBlockParams (int numSamples);
+    Ramp rampTo (float& last, float target, int numSamples) const noexcept;
+
+    void renderOscillators (const BlockParams& p, int startSample, int numSamples);
+    void shapeSource (const BlockParams& p, int startSample, int numSamples);
+    void runFilterNetwork (const BlockParams& p, int numSamples);
+    void runSpectralRotation (const BlockParams& p, int numSamples);
+    void shapeOutput (const BlockParams& p, int startSample, int numSamples);
+
+    void publishTelemetry (const juce::AudioBuffer<SampleType>& buffer);
+
+    void updateRotationWeights (size_t filter, float width);
+
+    // Multichannel layouts: project the outputs onto an L / R pair for the
+    // stereo-only stages, and spread a pair back out with pairGainL / R
+    void downmixToPair (int numSamples);
+    void spreadPair (int channelOffset, int numSamples, bool replace);
+
+    void resetFilter (int index);
+    void updateFilterLayout();
+    void updateLanes();
+    void seedRightLanes();
+    int getNumLanes() const noexcept   { return stereoLanes ? 2 * numFilters : numFilters; }
+    void updateFilterCoefficients();
+
     double sr = 44100.0;
+    int maxBlock = 512;
 
-    // Phase accumulators
-    float phaseA = 0.0f;
-    float phaseB = 0.0f;
-    float phaseC = 0.0f;
+    // Fixed-point phase accumulators (see AxisPhase.h): wrap on overflow
+    juce::uint32 phaseA = 0;
+    juce::uint32 phaseB = 0;
 
     // Base frequency
     float baseFreq = 55.0f;
@@ -30,12 +157,17 @@ private:
     float load = 0.4f;
     float mass = 0.5f;
     float wear = 0.2f;
-    
-    float crossModA = 0.0f;
-    float crossModB = 0.0f;
-    
+
     float rotationSmoothed = 0.0f;
-          
+
+    // LOAD drive / trim and WEAR diode drive reached at the end of the last
+    // block. The gains span 24 dB, so each block ramps on from these instead
+    // of stepping; after a reset the first block starts on its own values.
+    float lastPreGain = 1.0f, lastPostTrim = 1.0f, lastDiodeDrive = 1.0f;
+    bool settleRamps = true;
+
+    float modCentre = 0.0f, modSweep = 0.0f, modWidth = 0.0f;
+
     // Random drift state
     float driftA = 0.0f;
     float driftB = 0.0f;
@@ -45,21 +177,108 @@ private:
     // Simple random generator
     juce::Random random;
 
-    float spectralPhase = 0.0f;
-    
-    // Inertia smoothing for filter centers
-    float smoothedFcA = 400.0f;
-    float smoothedFcB = 600.0f;
+    // Decorrelated stereo: R oscillators and drift (the L side uses the above)
+    static constexpr double stereoDetune = 0.00116;   // ~2 cents, A up / B down
+    static constexpr float stereoCutoffOffset = 1.02f;   // R lanes, alternately up / down
+
+    bool decorrelate = false;
+    bool stereoLanes = false;   // decorrelate on a stereo output
+
+    juce::uint32 phaseAR = 0;
+    juce::uint32 phaseBR = 0;
+    float driftAR = 0.0f, driftBR = 0.0f;
+    float driftTargetAR = 0.0f, driftTargetBR = 0.0f;
+    juce::Random randomR;
+
+    // 64-bit so very slow rotation rates keep their exact increment
+    juce::uint64 spectralPhase = 0;
+
+    // Tempo sync
+    bool tempoSync = false;
+    double syncBeatsPerCycle = 16.0;
+    double syncBpm = 120.0;
+    double syncPpq = 0.0;
+    bool syncPositionPending = false;
 
-    // Simple damping lowpass state (post)
-    float dampL = 0.0f;
-    float dampR = 0.0f;
+    // Simple damping lowpass state (post), per output channel
+    std::array<SampleType, maxOutputs> damp {};
 
     // Sub oscillator phase
-    float phaseSub = 0.0f;
+    juce::uint32 phaseSub = 0;
 
-    // Filters (stereo-safe TPT)
-    juce::dsp::StateVariableTPTFilter<float> filterA_L, filterA_R;
-    juce::dsp::StateVariableTPTFilter<float> filterB_L, filterB_R;
-};
+    // ---- Rotating bandpass bank (SoA, one TPT SVF per lane) ----
+    // Lanes [0, numFilters) are the bank; with stereoLanes the R copy of
+    // filter k runs in lane numFilters + k, so both sides share the loops.
+    template <typename T>
+    using FilterLanes = std::array<T, maxLanes>;
+
+    int numFilters = 2;
+    float bankGain = 1.0f;   // keeps the summed level close to the pair
+
+    alignas (64) FilterLanes<juce::uint64> sweepOffset {};   // position around the spectral axis
+    alignas (64) FilterLanes<juce::uint64> panOffset {};     // position in the stereo rotation
+
+    alignas (64) FilterLanes<float> smoothedFc {};   // MASS inertia smoothing of the centres
+    alignas (64) FilterLanes<float> targetFc {};
+    alignas (64) FilterLanes<float> crossMod {};     // ring cross-mod: each filter nudges the next
+
+    // ---- Output layout ----
+    // Each channel's weight for a filter at rotation angle t is
+    //   omni + width * sum_j (sinWeight[j] * sin ((j + 1) t) + cosWeight[j] * cos ((j + 1) t))
+    // so speakers (j = 0 only) and circular harmonics share one formula.
+    static constexpr int maxHarmonics = 3;
+
+    int numOutputs = 2;              // rendered channels (mono bus: 1, weighted as R)
+    int numHarmonics = 1;
+    bool needsCosine = false;
+
+    alignas (64) std::array<float, maxOutputs> omniWeight {};
+    alignas (64) std::array<std::array<float, maxOutputs>, maxHarmonics> sinWeight {}, cosWeight {};
 
+    // Stages that only run on L / R (spectral rotator, modal body) reach the
+    // other channels through these gains
+    std::array<float, maxOutputs> pairGainL {}, pairGainR {};
+
+    // Per lane, per channel rotation weights (channels contiguous)
+    alignas (64) std::array<std::array<float, maxOutputs>, maxLanes> weights {};
+
+    alignas (64) FilterLanes<SampleType> g {}, h {}, R2 {};
+    alignas (64) FilterLanes<SampleType> s1 {}, s2 {};
+
+    static_assert (maxFilters <= AxisTelemetryFrame::maxFilters);
+
+    AxisTelemetry* telemetry = nullptr;
+
+    int mode = filterMode;
+    AxisSpectralRotator<SampleType> spectralRotator;
+
+    AxisModalBody<SampleType> modalBody;
+
+    // Stage buffers (one chunk of at most maxBlock samples)
+    juce::AudioBuffer<SampleType> sourceBuffer;   // sineA, sineB, sub (+ sineA / B R) -> stressed L / R in ch 0 / 1
+    juce::AudioBuffer<float> driftBuffer;         // per-sample driftA / driftB (+ R)
+    juce::AudioBuffer<SampleType> filterBuffer;   // filter network, numOutputs channels
+    juce::AudioBuffer<SampleType> pairBuffer;     // stereo-only stages: L / R (+ copy) for layouts > 2 ch
+
+    // Control-rate cutoff / weight updates (1 = every sample)
+    int controlInterval = 1;
+    int controlCountdown = 0;
+
+    // Rational tanh instead of std:: (not used by the ADAA stages)
+    bool fastShapers = false;
+
+    // ADAA: per side (L, R lanes) the fold, secondary fold, drive and
+    // excitation tanh stages; per output channel the diode clip
+    enum { foldStage = 0, fold2Stage, driveStage, stressStage, numSourceStages };
+
+    int antialiasing = 0;
+    std::array<std::array<AxisADAA::Stage<AxisADAA::Tanh>, numSourceStages>, 2> sourceAntialiasing;
+    std::array<AxisADAA::Stage<AxisADAA::Diode>, maxOutputs> outputAntialiasing;
+
+    // Selective oversampling (index 0 = off)
+    int oversamplingIndex = 0;
+    int oversamplingBlockSize = 0;
+    int oversamplingChannels = 0;
+    std::array<std::unique_ptr<juce::dsp::Oversampling<SampleType>>, 3> sourceOversampling;
+    std::array<std::unique_ptr<juce::dsp::Oversampling<SampleType>>, 3> outputOversampling;
+};
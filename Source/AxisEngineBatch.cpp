@@ -0,0 +1,89 @@
+#include "AxisEngineBatch.h"
+
+void AxisEngineBatch::prepare (double sampleRate, int newNumVariants, int maxBlockSize)
+{
+    constexpr int lanesPerGroup = AxisEngineLanes::numLanes;
+
+    numVariants = juce::jmax (0, newNumVariants);
+    maxBlock    = juce::jmax (1, maxBlockSize);
+
+    variants.assign ((size_t) numVariants, Variant());
+    groups.clear();
+
+    for (int k = 0; k < numVariants; k += lanesPerGroup)
+    {
+        auto group = std::make_unique<AxisEngineLanes>();
+        group->prepare (sampleRate, maxBlock);
+        groups.push_back (std::move (group));
+    }
+
+    reset();
+}
+
+void AxisEngineBatch::reset()
+{
+    for (auto& group : groups)
+        group->reset();
+}
+
+void AxisEngineBatch::setVariant (int index, const Variant& variant)
+{
+    constexpr int lanesPerGroup = AxisEngineLanes::numLanes;
+
+    jassert (juce::isPositiveAndBelow (index, numVariants));
+
+    variants[(size_t) index] = variant;
+
+    auto& group = *groups[(size_t) (index / lanesPerGroup)];
+    const int lane = index % lanesPerGroup;
+
+    group.setLaneFrequency (lane, variant.frequency);
+    group.setLaneMacros (lane, variant.rotation, variant.body, variant.load, variant.mass, variant.wear);
+}
+
+void AxisEngineBatch::setControlInterval (int numSamples)
+{
+    for (auto& group : groups)
+        group->setControlInterval (numSamples);
+}
+
+void AxisEngineBatch::setFastShapers (bool shouldUseApproximations)
+{
+    for (auto& group : groups)
+        group->setFastShapers (shouldUseApproximations);
+}
+
+void AxisEngineBatch::render (float* const* left, float* const* right, int numSamples)
+{
+    constexpr int lanesPerGroup = AxisEngineLanes::numLanes;
+
+    for (size_t g = 0; g < groups.size(); ++g)
+    {
+        auto& group = *groups[g];
+
+        const int first = (int) g * lanesPerGroup;
+        const int count = juce::jmin (lanesPerGroup, numVariants - first);
+
+        // Round the partial last group up to a vector width
+        const int lanesToRender = juce::jmin (lanesPerGroup, (count + 3) & ~3);
+
+        for (int start = 0; start < numSamples; start += maxBlock)
+        {
+            const int num = juce::jmin (maxBlock, numSamples - start);
+            group.process (num, lanesToRender);
+
+            // De-interleave lane frames into per-variant outputs
+            for (int lane = 0; lane < count; ++lane)
+            {
+                float* outL = left[first + lane]  + start;
+                float* outR = right[first + lane] + start;
+
+                for (int i = 0; i < num; ++i)
+                {
+                    outL[i] = group.getFrame (0, i)[lane];
+                    outR[i] = group.getFrame (1, i)[lane];
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,54 @@
+#pragma once
+#include <JuceHeader.h>
+#include "AxisEngineLanes.h"
+
+// Offline renderer for many AXIS parameter variants at once (preset / grid
+// sweeps). Variants are packed AxisEngineLanes::numLanes at a time, one SIMD
+// lane per variant, and rendered together. Each variant renders what an
+// AxisEngine<float> with the same frequency and macros renders when it is
+// reset after its setters and processed in blocks of maxBlockSize, within
+// the configuration AxisEngineLanes covers (stereo rotating pair, no
+// oversampling / ADAA / modal body / spectral mode). Plain C++ API, no
+// plugin wrapper.
+//
+//     AxisEngineBatch batch;
+//     batch.prepare (48000.0, (int) variants.size());
+//     for (int k = 0; k < (int) variants.size(); ++k)
+//         batch.setVariant (k, variants[k]);
+//     batch.reset();
+//     batch.render (leftPtrs.data(), rightPtrs.data(), numSamples);
+class AxisEngineBatch
+{
+public:
+    struct Variant
+    {
+        float rotation = 0.35f;
+        float body     = 0.5f;
+        float load     = 0.4f;
+        float mass     = 0.5f;
+        float wear     = 0.2f;
+        float frequency = 55.0f;
+    };
+
+    void prepare (double sampleRate, int numVariants, int maxBlockSize = 512);
+
+    // Every variant back to its start state, settled on its macros
+    void reset();
+
+    int getNumVariants() const noexcept { return numVariants; }
+    void setVariant (int index, const Variant& variant);
+
+    // Quality tiers for every variant (see AxisEngine)
+    void setControlInterval (int numSamples);
+    void setFastShapers (bool shouldUseApproximations);
+
+    // left[k] / right[k] receive numSamples of variant k
+    void render (float* const* left, float* const* right, int numSamples);
+
+private:
+    std::vector<std::unique_ptr<AxisEngineLanes>> groups;
+    std::vector<Variant> variants;
+
+    int numVariants = 0;
+    int maxBlock = 512;
+};
@@ -0,0 +1,388 @@
+#include "AxisEngineLanes.h"
+#include "AxisLaneMath.h"
+#include "AxisPhase.h"
+
+// The lane loops below repeat AxisEngine<float>'s expressions term for term
+// (same order, same float / double promotions): keep them in step with
+// AxisEngine.cpp, or the batch stops rendering what the engine renders.
+
+void AxisEngineLanes::prepare (double sampleRate, int maxBlockSize)
+{
+    sr = sampleRate;
+
+    outL.assign ((size_t) juce::jmax (1, maxBlockSize) * numLanes, 0.0f);
+    outR.assign ((size_t) juce::jmax (1, maxBlockSize) * numLanes, 0.0f);
+
+    // AxisEngine's defaults
+    for (int v = 0; v < numLanes; ++v)
+    {
+        setLaneFrequency (v, 55.0f);
+        setLaneMacros (v, 0.3f, 0.5f, 0.4f, 0.5f, 0.2f);
+    }
+
+    reset();
+}
+
+void AxisEngineLanes::reset()
+{
+    controlCountdown = 0;
+
+    for (int v = 0; v < numLanes; ++v)
+        resetLane (v);
+}
+
+void AxisEngineLanes::resetLane (int lane)
+{
+    const auto v = (size_t) lane;
+
+    phaseA[v] = phaseB[v] = phaseSub[v] = 0;
+    spectralPhase[v] = 0;
+    rotationSmoothed[v] = rotation[v];
+    settleRamps[v] = true;
+
+    driftA[v] = driftB[v] = 0.0f;
+    driftTargetA[v] = driftTargetB[v] = 0.0f;
+    random[v].setSeed (0x41584953);
+
+    smoothedFcA[v] = targetFcA[v] = 400.0f;
+    smoothedFcB[v] = targetFcB[v] = 600.0f;
+    crossModA[v] = crossModB[v] = 0.0f;
+
+    s1A[v] = s2A[v] = s1B[v] = s2B[v] = 0.0f;
+    weightAL[v] = weightAR[v] = weightBL[v] = weightBR[v] = 0.0f;
+    dampL[v] = dampR[v] = 0.0f;
+}
+
+void AxisEngineLanes::setLaneFrequency (int lane, float hz)
+{
+    baseFreq[(size_t) lane] = juce::jlimit (1.0f, 20000.0f, hz);
+}
+
+void AxisEngineLanes::setLaneMacros (int lane, float rot, float bod, float lod, float mas, float wer)
+{
+    const auto v = (size_t) lane;
+
+    rotation[v] = juce::jlimit (0.0f, 1.0f, rot);
+    body[v]     = juce::jlimit (0.0f, 1.0f, bod);
+    load[v]     = juce::jlimit (0.0f, 1.0f, lod);
+    mass[v]     = juce::jlimit (0.0f, 1.0f, mas);
+    wear[v]     = juce::jlimit (0.0f, 1.0f, wer);
+}
+
+void AxisEngineLanes::setControlInterval (int numSamples) noexcept
+{
+    controlInterval  = juce::jmax (1, numSamples);
+    controlCountdown = juce::jmin (controlCountdown, controlInterval);
+}
+
+//==============================================================================
+void AxisEngineLanes::updateBlockParams (int numSamples, int lanesToRender)
+{
+    // AxisEngine::rampTo
+    auto rampTo = [numSamples] (float& last, float target, bool settle, float& start, float& step)
+    {
+        start = settle ? target : last;
+        last = target;
+        step = (target - start) / (float) juce::jmax (1, numSamples);
+    };
+
+    // AxisEngine::updateBlockParams, once per lane per block
+    for (size_t v = 0; v < (size_t) lanesToRender; ++v)
+    {
+        const float m = mass[v];
+        const float b = body[v];
+        const float l = load[v];
+        const float w = wear[v];
+
+        // WEAR drift
+        driftAmount[v] = juce::jmap (w, 0.0f, 0.15f);
+        const float driftSpeedHz = juce::jmap (w, 0.1f, 2.0f);
+        driftInterval[v] = juce::jmax (1, (int) (sr / driftSpeedHz));
+
+        // Torque / rotation
+        const float torqueSpeed = juce::jmap (m, 0.2f, 0.01f);
+        rotationSmoothed[v] += torqueSpeed * (rotation[v] - rotationSmoothed[v]);
+
+        const float rs = rotationSmoothed[v];
+        const float rotationRate = juce::jmap (rs, 0.0005f, 0.03f) * juce::jmap (m, 1.0f, 0.35f);
+        rotationIncrement[v] = AxisPhase::increment64 (rotationRate, sr);
+
+        sweepOctaves[v] = juce::jmap (rs, 0.2f, 3.0f) * juce::jmap (m, 1.0f, 0.45f);
+        baseCentre[v]   = juce::jmap (b, 80.0f, 1200.0f);
+        width[v]        = juce::jlimit (0.0f, 1.0f, juce::jmap (rs, 0.05f, 1.0f));
+
+        // MASS inertia
+        const float tauSeconds = juce::jmap (m, 0.02f, 0.60f);
+        smoothA[v] = std::exp (-1.0f / (tauSeconds * (float) sr));
+
+        // BODY topology
+        const float bodyLow  = juce::jlimit (0.0f, 1.0f, b * 3.0f);
+        const float bodyMid  = juce::jlimit (0.0f, 1.0f, b * 3.0f - 1.0f);
+        const float bHigh    = juce::jlimit (0.0f, 1.0f, b * 3.0f - 2.0f);
+
+        const float resLow  = juce::jmap (bodyLow,  0.25f, 1.0f);
+        const float resMid  = juce::jmap (bodyMid,  1.0f, 3.5f);
+        const float resHigh = juce::jmap (bHigh,    3.5f, 6.5f);
+
+        float resonance = resLow * (1.0f - bodyMid) + resMid * (1.0f - bHigh) + resHigh * bHigh;
+        resonance *= juce::jmap (l, 1.0f, 0.65f);
+
+        const float qSkew = bHigh * 0.35f;
+        R2A[v] = 1.0f / (resonance * (1.0f + qSkew));
+        R2B[v] = 1.0f / (resonance * (1.0f - qSkew));
+
+        crossAmount[v] = bHigh * juce::jmap (m, 0.4f, 0.1f);
+        bodyHigh[v]    = bHigh;
+
+        // Folds, LOAD drive
+        foldAmount[v] = 1.0f + l * 4.0f;
+        fold2[v]      = 1.5f + b * 2.0f;
+        stress[v]     = 1.0f + bHigh * 0.6f;
+
+        rampTo (lastPreGain[v], juce::Decibels::decibelsToGain (juce::jmap (l, 0.0f, 24.0f)),
+                settleRamps[v], preGain[v], preGainStep[v]);
+        rampTo (lastPostTrim[v], juce::jmap (l, 1.0f, 0.25f), settleRamps[v], postTrim[v], postTrimStep[v]);
+
+        // MASS sub / damping
+        subGain[v] = juce::jmap (m, 0.0f, 0.35f);
+        dampMix[v] = juce::jmap (m, 0.0f, 0.65f);
+
+        const float dampCut = juce::jmap (m, 10000.0f, 1200.0f);
+        dampG[v] = 1.0f - std::exp (-juce::MathConstants<float>::twoPi * dampCut / (float) sr);
+
+        // WEAR instability + post saturation
+        instability[v] = juce::jmap (w, 0.0f, 0.003f);
+
+        rampTo (lastDiodeDrive[v], juce::jmap (w, 0.5f, 6.0f), settleRamps[v], diodeDrive[v], diodeDriveStep[v]);
+        asym[v] = juce::jmap (bHigh, 1.0f, 2.2f);
+
+        settleRamps[v] = false;
+
+        gritAmount[v] = b * 0.02f;
+
+        // Oscillator increments, set up like AxisEngine::renderOscillators
+        const double incrementA = baseFreq[v] / sr * AxisPhase::cycle32;
+        const double incrementB = incrementA * 1.01;
+
+        const AxisPhase::DriftingIncrement stepA (incrementA,  instability[v], driftA[v], driftTargetA[v]);
+        const AxisPhase::DriftingIncrement stepB (incrementB, -instability[v], driftB[v], driftTargetB[v]);
+
+        baseIncA[v] = stepA.base;
+        scaleA[v]   = stepA.scale;
+        offsetA[v]  = stepA.offset;
+        targetA[v]  = stepA.target;
+
+        baseIncB[v] = stepB.base;
+        scaleB[v]   = stepB.scale;
+        offsetB[v]  = stepB.offset;
+        targetB[v]  = stepB.target;
+
+        incSub[v] = AxisPhase::increment32 (baseFreq[v] * 0.5, sr);
+    }
+
+    updateFilterCoefficients (lanesToRender);
+}
+
+int AxisEngineLanes::retargetDrift (int sampleIndex, int lanesToRender)
+{
+    // Rare (block start, then every driftInterval samples): scalar, returns
+    // the next sample index where any lane retargets
+    int next = std::numeric_limits<int>::max();
+
+    for (size_t v = 0; v < (size_t) lanesToRender; ++v)
+    {
+        const int interval = driftInterval[v];
+
+        if (sampleIndex % interval == 0)
+        {
+            driftTargetA[v] = random[v].nextFloat() * 2.0f - 1.0f;
+            driftTargetB[v] = random[v].nextFloat() * 2.0f - 1.0f;
+
+            targetA[v] = (juce::int64) (scaleA[v] * driftTargetA[v]);
+            targetB[v] = (juce::int64) (scaleB[v] * driftTargetB[v]);
+        }
+
+        next = juce::jmin (next, (sampleIndex / interval + 1) * interval);
+    }
+
+    return next;
+}
+
+template <bool fast>
+void AxisEngineLanes::renderSource (int lanesToRender, float position)
+{
+    auto shaper = [] (float x) { return fast ? AxisMath::tanh (x) : std::tanh (x); };
+
+    for (size_t v = 0; v < (size_t) lanesToRender; ++v)
+    {
+        driftA[v] += 0.0005f * (driftTargetA[v] - driftA[v]);
+        driftB[v] += 0.0005f * (driftTargetB[v] - driftB[v]);
+
+        // Oscillator stack
+        offsetA[v] += ((targetA[v] - offsetA[v]) * 131) >> 18;
+        offsetB[v] += ((targetB[v] - offsetB[v]) * 131) >> 18;
+
+        phaseA[v]   += baseIncA[v] + (juce::uint32) (offsetA[v] >> 16);
+        phaseB[v]   += baseIncB[v] + (juce::uint32) (offsetB[v] >> 16);
+        phaseSub[v] += incSub[v];
+
+        const float a = AxisPhase::sine<float> (phaseA[v]);
+        const float b = AxisPhase::sine<float> (phaseB[v]);
+        const float s = AxisPhase::sine<float> (phaseSub[v]);
+
+        // Folds, grind, LOAD drive + excitation
+        float folded = shaper (a * foldAmount[v]);
+        folded = shaper (folded * fold2[v]);
+
+        float osc = (a * 0.3f) + (b * 0.2f) + (folded * 0.5f);
+        const float grind = osc * std::abs (osc);
+        osc = juce::jmap (bodyHigh[v], osc, grind);
+
+        osc += s * subGain[v];
+
+        float driven = shaper (osc * (preGain[v] + preGainStep[v] * position));
+        driven *= postTrim[v] + postTrimStep[v] * position;
+
+        stressed[v] = shaper (driven * stress[v]);
+    }
+}
+
+void AxisEngineLanes::updateControl (int lanesToRender)
+{
+    constexpr auto halfCycle = (juce::uint64) 1 << 63;
+
+    for (size_t v = 0; v < (size_t) lanesToRender; ++v)
+    {
+        // Filter A sweeps from the rotation phase, B a quarter cycle on
+        const float modA = AxisPhase::sine<float> (spectralPhase[v]);
+        const float modB = AxisPhase::sine<float> (spectralPhase[v] + AxisPhase::quarter64);
+
+        const float fcA = baseCentre[v] * std::exp2 (modA * sweepOctaves[v]) * (1.0f + driftA[v] * driftAmount[v]);
+        const float fcB = baseCentre[v] * std::exp2 (modB * sweepOctaves[v]) * (1.0f + driftB[v] * driftAmount[v]);
+
+        targetFcA[v] = juce::jlimit (20.0f, 18000.0f, fcA);
+        targetFcB[v] = juce::jlimit (20.0f, 18000.0f, fcB);
+
+        // Stereo weights: A panned at the rotation phase, B half a cycle on
+        // (the pair's bank gain is 1)
+        const float panA = width[v] * modA;
+        const float panB = width[v] * AxisPhase::sine<float> (spectralPhase[v] + halfCycle);
+
+        weightAL[v] = 0.5f + 0.5f * panA;
+        weightAR[v] = 0.5f + -0.5f * panA;
+        weightBL[v] = 0.5f + 0.5f * panB;
+        weightBR[v] = 0.5f + -0.5f * panB;
+    }
+}
+
+void AxisEngineLanes::updateFilterCoefficients (int lanesToRender)
+{
+    const auto wScale = (float) (juce::MathConstants<double>::pi / sr);
+    const auto wLimit = (float) (0.49 * juce::MathConstants<double>::pi);
+
+    for (size_t v = 0; v < (size_t) lanesToRender; ++v)
+    {
+        gA[v] = AxisMath::tan (juce::jmin (smoothedFcA[v] * wScale, wLimit));
+        gB[v] = AxisMath::tan (juce::jmin (smoothedFcB[v] * wScale, wLimit));
+        hA[v] = 1.0f / (1.0f + R2A[v] * gA[v] + gA[v] * gA[v]);
+        hB[v] = 1.0f / (1.0f + R2B[v] * gB[v] + gB[v] * gB[v]);
+    }
+}
+
+//==============================================================================
+void AxisEngineLanes::process (int numSamples, int lanesToRender)
+{
+    jassert ((size_t) numSamples * numLanes <= outL.size());
+    lanesToRender = juce::jlimit (0, (int) numLanes, lanesToRender);
+
+    updateBlockParams (numSamples, lanesToRender);
+
+    const auto n = (size_t) lanesToRender;
+    int nextRetarget = 0;
+
+    for (int i = 0; i < numSamples; ++i)
+    {
+        if (i == nextRetarget)
+            nextRetarget = retargetDrift (i, lanesToRender);
+
+        // Ramp position of this sample
+        const float position = (float) (i + 1);
+
+        if (fastShapers)
+            renderSource<true> (lanesToRender, position);
+        else
+            renderSource<false> (lanesToRender, position);
+
+        for (size_t v = 0; v < n; ++v)
+            spectralPhase[v] += rotationIncrement[v];
+
+        const bool controlTick = --controlCountdown <= 0;
+
+        if (controlTick)
+        {
+            controlCountdown = controlInterval;
+            updateControl (lanesToRender);
+        }
+
+        // MASS inertia smoothing of the cutoffs
+        for (size_t v = 0; v < n; ++v)
+        {
+            smoothedFcA[v] = smoothA[v] * smoothedFcA[v] + (1.0f - smoothA[v]) * targetFcA[v];
+            smoothedFcB[v] = smoothA[v] * smoothedFcB[v] + (1.0f - smoothA[v]) * targetFcB[v];
+        }
+
+        if (controlTick)
+            updateFilterCoefficients (lanesToRender);
+
+        float* frameL = outL.data() + (size_t) i * numLanes;
+        float* frameR = outR.data() + (size_t) i * numLanes;
+
+        // ---- Lane loop: filter pair, post saturation, damping ----
+        for (size_t v = 0; v < n; ++v)
+        {
+            const float x = stressed[v];
+
+            const float hpA = hA[v] * (x - s1A[v] * (gA[v] + R2A[v]) - s2A[v]);
+            const float bpA = hpA * gA[v] + s1A[v];
+            s1A[v] = hpA * gA[v] + bpA;
+            s2A[v] += 2.0f * bpA * gA[v];
+
+            const float hpB = hB[v] * (x - s1B[v] * (gB[v] + R2B[v]) - s2B[v]);
+            const float bpB = hpB * gB[v] + s1B[v];
+            s1B[v] = hpB * gB[v] + bpB;
+            s2B[v] += 2.0f * bpB * gB[v];
+
+            crossModA[v] += 0.001f * (std::abs (bpA) - crossModA[v]);
+            crossModB[v] += 0.001f * (std::abs (bpB) - crossModB[v]);
+
+            float sumL = 0.0f, sumR = 0.0f;
+            sumL += bpA * weightAL[v];
+            sumR += bpA * weightAR[v];
+            sumL += bpB * weightBL[v];
+            sumR += bpB * weightBR[v];
+
+            // Cross modulation around the ring, then the safety clamp
+            smoothedFcA[v] *= (1.0f + crossAmount[v] * crossModB[v]);
+            smoothedFcB[v] *= (1.0f + crossAmount[v] * crossModA[v]);
+
+            smoothedFcA[v] = juce::jlimit (20.0f, 18000.0f, smoothedFcA[v]);
+            smoothedFcB[v] = juce::jlimit (20.0f, 18000.0f, smoothedFcB[v]);
+
+            // WEAR diode saturation + grit
+            const float drive = diodeDrive[v] + diodeDriveStep[v] * position;
+
+            float outLeft  = AxisMath::diodeClip (sumL, drive, drive * asym[v]);
+            float outRight = AxisMath::diodeClip (sumR, drive, drive * asym[v]);
+
+            outLeft  = outLeft  + ((outLeft  * outLeft  * outLeft)  - outLeft)  * gritAmount[v];
+            outRight = outRight + ((outRight * outRight * outRight) - outRight) * gritAmount[v];
+
+            // MASS damping, blended with the raw signal
+            dampL[v] += dampG[v] * (outLeft  - dampL[v]);
+            dampR[v] += dampG[v] * (outRight - dampR[v]);
+
+            frameL[v] = outLeft  * (1.0f - dampMix[v]) + dampL[v] * dampMix[v];
+            frameR[v] = outRight * (1.0f - dampMix[v]) + dampR[v] * dampMix[v];
+        }
+    }
+}
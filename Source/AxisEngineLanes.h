@@ -0,0 +1,113 @@
+#pragma once
+#include <JuceHeader.h>
+
+// AxisEngine<float> in structure-of-arrays form: numLanes independent engine
+// states rendered together, one lane per engine. Each lane runs the same
+// arithmetic as AxisEngine<float>::process() in its default configuration,
+// so a lane renders what an AxisEngine driven with the same block sizes
+// renders:
+//
+//   stereo output, rotating filter pair (2 filters), filter mode,
+//   no decorrelation, tempo sync or internal modulation
+//
+// Out of scope (an AxisEngine is needed for these): oversampling, ADAA, the
+// modal body, the spectral rotator, larger filter banks, decorrelated stereo
+// and other output layouts. The quality tiers (control interval, fast
+// shapers) are supported and shared by all lanes.
+//
+// Per-sample work runs over contiguous lane arrays so the arithmetic
+// vectorises across lanes. Nothing allocates after prepare().
+class AxisEngineLanes
+{
+public:
+    static constexpr int numLanes = 16;
+
+    void prepare (double sampleRate, int maxBlockSize);
+
+    // Every lane back to AxisEngine::reset()'s start state, settled on its
+    // current macros
+    void reset();
+    void resetLane (int lane);
+
+    void setLaneFrequency (int lane, float hz);
+    void setLaneMacros (int lane, float rotation, float body, float load, float mass, float wear);
+
+    // Same as AxisEngine::setControlInterval / setFastShapers
+    void setControlInterval (int numSamples) noexcept;
+    void setFastShapers (bool shouldUseApproximations) noexcept   { fastShapers = shouldUseApproximations; }
+
+    // One AxisEngine::process() call of numSamples (<= maxBlockSize) for
+    // lanes [0, lanesToRender). Output is lane-interleaved: frame i of a
+    // channel is numLanes floats.
+    void process (int numSamples, int lanesToRender);
+
+    const float* getFrame (int channel, int sampleIndex) const noexcept
+    {
+        return (channel == 0 ? outL : outR).data() + (size_t) sampleIndex * numLanes;
+    }
+
+private:
+    void updateBlockParams (int numSamples, int lanesToRender);
+    int retargetDrift (int sampleIndex, int lanesToRender);
+
+    template <bool fast>
+    void renderSource (int lanesToRender, float position);
+
+    void updateControl (int lanesToRender);
+    void updateFilterCoefficients (int lanesToRender);
+
+    template <typename T>
+    using Lanes = std::array<T, numLanes>;
+
+    double sr = 44100.0;
+
+    int controlInterval = 1;
+    int controlCountdown = 0;
+    bool fastShapers = false;
+
+    // ---- Per-lane inputs ----
+    alignas (64) Lanes<float> baseFreq {};
+    alignas (64) Lanes<float> rotation {}, body {}, load {}, mass {}, wear {};
+
+    // ---- Per-lane block parameters (AxisEngine::BlockParams) ----
+    alignas (64) Lanes<float> driftAmount {}, instability {};
+    alignas (64) Lanes<int>   driftInterval {};
+    alignas (64) Lanes<juce::uint64> rotationIncrement {};
+    alignas (64) Lanes<float> sweepOctaves {}, baseCentre {}, width {};
+    alignas (64) Lanes<float> smoothA {}, crossAmount {};
+    alignas (64) Lanes<float> bodyHigh {}, foldAmount {}, fold2 {}, stress {};
+    alignas (64) Lanes<float> subGain {}, asym {}, gritAmount {};
+    alignas (64) Lanes<float> dampMix {}, dampG {};
+
+    // LOAD drive / trim and WEAR diode drive ramps (AxisEngine::Ramp): value
+    // after n samples is start + step * n
+    alignas (64) Lanes<float> preGain {}, postTrim {}, diodeDrive {};
+    alignas (64) Lanes<float> preGainStep {}, postTrimStep {}, diodeDriveStep {};
+    alignas (64) Lanes<float> lastPreGain {}, lastPostTrim {}, lastDiodeDrive {};
+    Lanes<bool> settleRamps {};
+
+    // Drifting oscillator increments (AxisPhase::DriftingIncrement per lane)
+    alignas (64) Lanes<juce::uint32> baseIncA {}, baseIncB {}, incSub {};
+    alignas (64) Lanes<double> scaleA {}, scaleB {};
+    alignas (64) Lanes<juce::int64> offsetA {}, offsetB {}, targetA {}, targetB {};
+
+    // ---- Per-lane state ----
+    alignas (64) Lanes<juce::uint32> phaseA {}, phaseB {}, phaseSub {};
+    alignas (64) Lanes<juce::uint64> spectralPhase {};
+    alignas (64) Lanes<float> rotationSmoothed {};
+    alignas (64) Lanes<float> driftA {}, driftB {}, driftTargetA {}, driftTargetB {};
+    std::array<juce::Random, numLanes> random;
+
+    // Rotating pair: filter A (lane arrays ...A) and filter B
+    alignas (64) Lanes<float> smoothedFcA {}, smoothedFcB {}, targetFcA {}, targetFcB {};
+    alignas (64) Lanes<float> crossModA {}, crossModB {};
+    alignas (64) Lanes<float> R2A {}, R2B {}, gA {}, gB {}, hA {}, hB {};
+    alignas (64) Lanes<float> s1A {}, s2A {}, s1B {}, s2B {};
+    alignas (64) Lanes<float> weightAL {}, weightAR {}, weightBL {}, weightBR {};
+    alignas (64) Lanes<float> dampL {}, dampR {};
+
+    // Stressed source of the current sample
+    alignas (64) Lanes<float> stressed {};
+
+    std::vector<float> outL, outR;
+};
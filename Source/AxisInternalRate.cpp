@@ -0,0 +1,83 @@
+#include "AxisInternalRate.h"
+
+void AxisInternalRate::prepare (double hostRate, int maxHostBlockSize, int numChannels, double targetRate)
+{
+    // Largest power-of-two factor that keeps the internal rate at or above ~target
+    int stages = 0;
+
+    while (stages < 3 && hostRate / (double) (2 << stages) >= targetRate * 0.9)
+        ++stages;
+
+    factor = 1 << stages;
+    internalRate = hostRate / factor;
+
+    numChannels = juce::jmax (1, numChannels);
+    chunkSize   = juce::jmax (1, maxHostBlockSize / factor);
+
+    internalBuffer.setSize (numChannels, chunkSize);
+    fifo.setSize (numChannels, chunkSize * factor);
+
+    oversampler.reset();
+    latencySamples = 0;
+
+    if (factor > 1)
+    {
+        oversampler = std::make_unique<juce::dsp::Oversampling<float>> ((size_t) numChannels, (size_t) stages,
+                                                                        juce::dsp::Oversampling<float>::filterHalfBandFIREquiripple,
+                                                                        true, true);
+        oversampler->initProcessing ((size_t) chunkSize);
+
+        latencySamples = measureUpsamplingLatency();
+    }
+
+    reset();
+}
+
+int AxisInternalRate::measureUpsamplingLatency()
+{
+    // getLatencyInSamples() is the up + down round trip, and JUCE designs the
+    // two filters of each stage with different transition widths and
+    // attenuations, so half of it isn't the up path's delay. The cascade is
+    // linear phase: its impulse response peaks at the delay.
+    constexpr int maxLatency = 4096;   // well beyond a three-stage half-band cascade
+
+    int peakIndex = 0;
+    float peak = 0.0f;
+
+    oversampler->reset();
+
+    for (int offset = 0; offset < maxLatency; offset += chunkSize * factor)
+    {
+        internalBuffer.clear();
+
+        if (offset == 0)
+            internalBuffer.setSample (0, 0, 1.0f);
+
+        juce::dsp::AudioBlock<float> block (internalBuffer);
+        const auto upsampled = oversampler->processSamplesUp (block);
+        const auto* data = upsampled.getChannelPointer (0);
+
+        for (size_t i = 0; i < upsampled.getNumSamples(); ++i)
+        {
+            if (std::abs (data[i]) > peak)
+            {
+                peak = std::abs (data[i]);
+                peakIndex = offset + (int) i;
+            }
+        }
+    }
+
+    return peakIndex;
+}
+
+void AxisInternalRate::reset()
+{
+    if (oversampler != nullptr)
+        oversampler->reset();
+
+    internalBuffer.clear();
+    fifo.clear();
+
+    fifoCount = 0;
+    fifoReadPos = 0;
+}
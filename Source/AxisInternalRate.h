@@ -0,0 +1,74 @@
+#pragma once
+#include <JuceHeader.h>
+
+// Runs a generator at a fixed internal rate (host rate / 2^n, close to 48 kHz)
+// and up-samples the result to the host rate with a polyphase half-band FIR.
+// At 96 / 192 kHz the engine then only does 44.1 / 48 kHz worth of work.
+class AxisInternalRate
+{
+public:
+    void prepare (double hostRate, int maxHostBlockSize, int numChannels, double targetRate = 48000.0);
+    void reset();
+
+    bool isActive() const noexcept            { return factor > 1; }
+    double getInternalRate() const noexcept   { return internalRate; }
+    int getMaxInternalBlockSize() const noexcept { return chunkSize; }
+
+    // Up-sampling latency in host-rate samples, measured in prepare()
+    int getLatencySamples() const noexcept    { return latencySamples; }
+
+    // Fills hostBuffer; render (juce::AudioBuffer<float>&, int hostOffset) is
+    // called to produce internal-rate chunks of getMaxInternalBlockSize()
+    // samples as needed. hostOffset is the position in hostBuffer where the
+    // chunk's first (up-sampled) sample will land.
+    template <typename RenderFn>
+    void process (juce::AudioBuffer<float>& hostBuffer, RenderFn&& render)
+    {
+        const int numSamples = hostBuffer.getNumSamples();
+        const int numCh = juce::jmin (hostBuffer.getNumChannels(), internalBuffer.getNumChannels());
+
+        int written = 0;
+
+        while (written < numSamples)
+        {
+            if (fifoReadPos >= fifoCount)
+            {
+                internalBuffer.clear();
+                render (internalBuffer, written);
+
+                juce::dsp::AudioBlock<float> block (internalBuffer);
+                auto upsampled = oversampler->processSamplesUp (block);
+
+                fifoCount = (int) upsampled.getNumSamples();
+                fifoReadPos = 0;
+
+                for (int ch = 0; ch < numCh; ++ch)
+                    fifo.copyFrom (ch, 0, upsampled.getChannelPointer ((size_t) ch), fifoCount);
+            }
+
+            const int num = juce::jmin (numSamples - written, fifoCount - fifoReadPos);
+
+            for (int ch = 0; ch < numCh; ++ch)
+                hostBuffer.copyFrom (ch, written, fifo, ch, fifoReadPos, num);
+
+            fifoReadPos += num;
+            written += num;
+        }
+    }
+
+private:
+    int measureUpsamplingLatency();
+
+    std::unique_ptr<juce::dsp::Oversampling<float>> oversampler;
+
+    juce::AudioBuffer<float> internalBuffer;   // one chunk at the internal rate
+    juce::AudioBuffer<float> fifo;             // one up-sampled chunk at the host rate
+
+    int fifoCount = 0;
+    int fifoReadPos = 0;
+
+    int factor = 1;
+    int chunkSize = 512;
+    int latencySamples = 0;
+    double internalRate = 44100.0;
+};
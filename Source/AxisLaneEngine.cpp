@@ -0,0 +1,326 @@
+#include "AxisLaneEngine.h"
+#include "AxisLaneMath.h"
+#include "AxisPhase.h"
+
+void AxisLaneEngine::prepare (double sampleRate, int maxBlockSize)
+{
+    sr = sampleRate;
+    controlCountdown = 0;
+
+    outL.assign ((size_t) juce::jmax (1, maxBlockSize) * numLanes, 0.0f);
+    outR.assign ((size_t) juce::jmax (1, maxBlockSize) * numLanes, 0.0f);
+
+    for (int v = 0; v < numLanes; ++v)
+    {
+        setLaneFrequency (v, 55.0f);
+        setLaneMacros (v, 0.3f, 0.5f, 0.4f, 0.5f, 0.2f);
+    }
+
+    reset();
+}
+
+void AxisLaneEngine::reset()
+{
+    controlCountdown = 0;
+
+    for (int v = 0; v < numLanes; ++v)
+    {
+        seed[(size_t) v] = 0x9e3779b9u * (uint32_t) (v + 1);
+        setLaneGate (v, false, 0.0f);
+        resetLane (v);
+        env[(size_t) v] = 0.0f;
+    }
+}
+
+void AxisLaneEngine::resetLane (int lane)
+{
+    const auto v = (size_t) lane;
+
+    phaseA[v] = phaseB[v] = phaseSub[v] = 0;
+    spectralPhase[v] = 0;
+
+    driftA[v] = driftB[v] = 0.0f;
+    driftTargetA[v] = driftTargetB[v] = 0.0f;
+    driftCountdown[v] = 0;
+
+    smoothedFcA[v] = 400.0f;
+    smoothedFcB[v] = 600.0f;
+    crossModA[v] = crossModB[v] = 0.0f;
+
+    // A retriggered voice starts with its rotation and drive already settled
+    rotationSmoothed[v] = rotation[v];
+    settleRamps[v] = true;
+
+    s1A[v] = s2A[v] = s1B[v] = s2B[v] = 0.0f;
+    dampL[v] = dampR[v] = 0.0f;
+}
+
+void AxisLaneEngine::setLaneFrequency (int lane, float hz)
+{
+    baseInc[(size_t) lane] = (float) (hz / sr * AxisPhase::cycle32);
+}
+
+void AxisLaneEngine::setLaneMacros (int lane, float rot, float bod, float lod, float mas, float wer)
+{
+    const auto v = (size_t) lane;
+
+    rotation[v] = juce::jlimit (0.0f, 1.0f, rot);
+    body[v]     = juce::jlimit (0.0f, 1.0f, bod);
+    load[v]     = juce::jlimit (0.0f, 1.0f, lod);
+    mass[v]     = juce::jlimit (0.0f, 1.0f, mas);
+    wear[v]     = juce::jlimit (0.0f, 1.0f, wer);
+}
+
+void AxisLaneEngine::setLaneGate (int lane, bool on, float vel)
+{
+    const auto v = (size_t) lane;
+
+    // 5 ms attack, 150 ms release
+    if (on)
+    {
+        velocity[v] = vel;
+        envRate[v]  = 1.0f / (0.005f * (float) sr);
+    }
+    else
+    {
+        envRate[v] = -1.0f / (0.150f * (float) sr);
+    }
+}
+
+void AxisLaneEngine::openLane (int lane)
+{
+    setLaneGate (lane, true, 1.0f);
+    env[(size_t) lane] = 1.0f;
+}
+
+bool AxisLaneEngine::isLaneSilent (int lane) const noexcept
+{
+    return env[(size_t) lane] <= 0.0f && envRate[(size_t) lane] <= 0.0f;
+}
+
+//==============================================================================
+void AxisLaneEngine::updateBlockMappings (int numSamples)
+{
+    // The voice bank calls process() once per MIDI sub-block, so the torque
+    // step is scaled to the sub-block length: rotation glides at the same
+    // speed however densely the notes arrive
+    const float torqueBlocks = (float) numSamples / (float) torqueBlock;
+
+    auto rampTo = [numSamples] (float& last, float target, bool settle, float& start, float& step)
+    {
+        start = settle ? target : last;
+        last = target;
+        step = (target - start) / (float) juce::jmax (1, numSamples);
+    };
+
+    // Same macro mappings as AxisEngine::process, evaluated once per lane per block
+    for (size_t v = 0; v < (size_t) numLanes; ++v)
+    {
+        const float m = mass[v];
+        const float b = body[v];
+        const float l = load[v];
+        const float w = wear[v];
+
+        // WEAR drift
+        driftAmount[v] = juce::jmap (w, 0.0f, 0.15f);
+        const float driftSpeedHz = juce::jmap (w, 0.1f, 2.0f);
+        driftInterval[v] = juce::jmax (1, (int) (sr / driftSpeedHz) / controlInterval);
+        instability[v] = juce::jmap (w, 0.0f, 0.003f);
+
+        // Torque / rotation
+        const float torqueSpeed = 1.0f - std::pow (1.0f - juce::jmap (m, 0.2f, 0.01f), torqueBlocks);
+        rotationSmoothed[v] += torqueSpeed * (rotation[v] - rotationSmoothed[v]);
+
+        const float rs = rotationSmoothed[v];
+        const float rotationRate = juce::jmap (rs, 0.0005f, 0.03f) * juce::jmap (m, 1.0f, 0.35f);
+        rotInc[v]       = AxisPhase::increment32 (rotationRate * (float) controlInterval, sr);
+        sweepOctaves[v] = juce::jmap (rs, 0.2f, 3.0f) * juce::jmap (m, 1.0f, 0.45f);
+        width[v]        = juce::jmap (rs, 0.05f, 1.0f);
+
+        // BODY centre + MASS inertia (per control step)
+        baseCentre[v] = juce::jmap (b, 80.0f, 1200.0f);
+
+        const float tauSeconds = juce::jmap (m, 0.02f, 0.60f);
+        smoothA[v] = std::exp (-(float) controlInterval / (tauSeconds * (float) sr));
+
+        // BODY topology
+        const float bodyLow  = juce::jlimit (0.0f, 1.0f, b * 3.0f);
+        const float bodyMid  = juce::jlimit (0.0f, 1.0f, b * 3.0f - 1.0f);
+        const float bHigh    = juce::jlimit (0.0f, 1.0f, b * 3.0f - 2.0f);
+
+        const float resLow  = juce::jmap (bodyLow, 0.25f, 1.0f);
+        const float resMid  = juce::jmap (bodyMid, 1.0f, 3.5f);
+        const float resHigh = juce::jmap (bHigh,   3.5f, 6.5f);
+
+        float resonance = resLow * (1.0f - bodyMid) + resMid * (1.0f - bHigh) + resHigh * bHigh;
+        resonance *= juce::jmap (l, 1.0f, 0.65f);
+
+        const float qSkew = bHigh * 0.35f;
+        R2A[v] = 1.0f / (resonance * (1.0f + qSkew));
+        R2B[v] = 1.0f / (resonance * (1.0f - qSkew));
+
+        crossAmount[v] = bHigh * juce::jmap (m, 0.4f, 0.1f);
+        bodyHigh[v]    = bHigh;
+        stress[v]      = 1.0f + bHigh * 0.6f;
+        foldAmount[v]  = 1.0f + l * 4.0f;
+        fold2[v]       = 1.5f + b * 2.0f;
+
+        // LOAD drive, ramped across the block
+        rampTo (lastPreGain[v], juce::Decibels::decibelsToGain (juce::jmap (l, 0.0f, 24.0f)),
+                settleRamps[v], preGain[v], preGainStep[v]);
+        rampTo (lastPostTrim[v], juce::jmap (l, 1.0f, 0.25f), settleRamps[v], postTrim[v], postTrimStep[v]);
+
+        // MASS sub / damping
+        subGain[v] = juce::jmap (m, 0.0f, 0.35f);
+        dampMix[v] = juce::jmap (m, 0.0f, 0.65f);
+
+        const float dampCut = juce::jmap (m, 10000.0f, 1200.0f);
+        dampG[v] = 1.0f - std::exp (-juce::MathConstants<float>::twoPi * dampCut / (float) sr);
+
+        // WEAR post saturation
+        rampTo (lastDiodeDrive[v], juce::jmap (w, 0.5f, 6.0f), settleRamps[v], diodeDrive[v], diodeDriveStep[v]);
+        asym[v] = juce::jmap (bHigh, 1.0f, 2.2f);
+
+        settleRamps[v] = false;
+
+        gritAmount[v] = b * 0.02f;
+    }
+}
+
+void AxisLaneEngine::updateControl (int lanesToRender)
+{
+    // Per-sample drift smoothing (0.0005) folded into one control step
+    const float driftStep = 1.0f - std::pow (1.0f - 0.0005f, (float) controlInterval);
+    const float nyquistGuard = 0.49f * (float) sr;
+    const float pi = juce::MathConstants<float>::pi;
+
+    for (size_t v = 0; v < (size_t) lanesToRender; ++v)
+    {
+        if (--driftCountdown[v] <= 0)
+        {
+            driftCountdown[v] = driftInterval[v];
+            driftTargetA[v] = AxisMath::nextBipolar (seed[v]);
+            driftTargetB[v] = AxisMath::nextBipolar (seed[v]);
+        }
+
+        driftA[v] += driftStep * (driftTargetA[v] - driftA[v]);
+        driftB[v] += driftStep * (driftTargetB[v] - driftB[v]);
+
+        spectralPhase[v] += rotInc[v];
+
+        const float modA = AxisPhase::sine<float> (spectralPhase[v]);
+        const float modB = AxisPhase::sine<float> (spectralPhase[v] + (1u << 30));
+
+        float fcA = baseCentre[v] * std::exp2 (modA * sweepOctaves[v]) * (1.0f + driftA[v] * driftAmount[v]);
+        float fcB = baseCentre[v] * std::exp2 (modB * sweepOctaves[v]) * (1.0f + driftB[v] * driftAmount[v]);
+
+        fcA = juce::jlimit (20.0f, 18000.0f, fcA);
+        fcB = juce::jlimit (20.0f, 18000.0f, fcB);
+
+        smoothedFcA[v] = smoothA[v] * smoothedFcA[v] + (1.0f - smoothA[v]) * fcA;
+        smoothedFcB[v] = smoothA[v] * smoothedFcB[v] + (1.0f - smoothA[v]) * fcB;
+
+        // Cross-mod nudge, compounded over the control step
+        smoothedFcA[v] *= std::pow (1.0f + crossAmount[v] * crossModB[v], (float) controlInterval);
+        smoothedFcB[v] *= std::pow (1.0f + crossAmount[v] * crossModA[v], (float) controlInterval);
+
+        smoothedFcA[v] = juce::jlimit (20.0f, 18000.0f, smoothedFcA[v]);
+        smoothedFcB[v] = juce::jlimit (20.0f, 18000.0f, smoothedFcB[v]);
+
+        gA[v] = AxisMath::tan (pi * juce::jmin (smoothedFcA[v], nyquistGuard) / (float) sr);
+        gB[v] = AxisMath::tan (pi * juce::jmin (smoothedFcB[v], nyquistGuard) / (float) sr);
+        hA[v] = 1.0f / (1.0f + R2A[v] * gA[v] + gA[v] * gA[v]);
+        hB[v] = 1.0f / (1.0f + R2B[v] * gB[v] + gB[v] * gB[v]);
+
+        // Stereo spectral rotation weight
+        weightL[v] = juce::jlimit (0.0f, 1.0f, 0.5f + 0.5f * width[v] * modA);
+        weightR[v] = juce::jlimit (0.0f, 1.0f, 0.5f - 0.5f * width[v] * modA);
+    }
+}
+
+//==============================================================================
+void AxisLaneEngine::process (int numSamples, int lanesToRender)
+{
+    jassert ((size_t) numSamples * numLanes <= outL.size());
+    lanesToRender = juce::jlimit (0, (int) numLanes, lanesToRender);
+
+    updateBlockMappings (numSamples);
+
+    const auto n = (size_t) lanesToRender;
+
+    for (int i = 0; i < numSamples; ++i)
+    {
+        if (controlCountdown <= 0)
+        {
+            updateControl (lanesToRender);
+            controlCountdown = controlInterval;
+        }
+
+        --controlCountdown;
+
+        float* frameL = outL.data() + (size_t) i * numLanes;
+        float* frameR = outR.data() + (size_t) i * numLanes;
+
+        const float position = (float) (i + 1);
+
+        // ---- Lane loop (vectorised across voices) ----
+        for (size_t v = 0; v < n; ++v)
+        {
+            // Oscillator stack
+            phaseA[v]   += (uint32_t) (int32_t) (baseInc[v] * (1.0f + instability[v] * driftA[v]));
+            phaseB[v]   += (uint32_t) (int32_t) (baseInc[v] * 1.01f * (1.0f - instability[v] * driftB[v]));
+            phaseSub[v] += (uint32_t) (int32_t) (baseInc[v] * 0.5f);
+
+            // No table gathers here: the signed phase feeds the polynomial sine
+            const float sineA = AxisMath::sinCycles (AxisMath::signedCycles (phaseA[v]));
+            const float sineB = AxisMath::sinCycles (AxisMath::signedCycles (phaseB[v]));
+
+            float folded = AxisMath::tanh (sineA * foldAmount[v]);
+            folded = AxisMath::tanh (folded * fold2[v]);
+
+            float osc = (sineA * 0.3f) + (sineB * 0.2f) + (folded * 0.5f);
+            osc += bodyHigh[v] * (osc * std::abs (osc) - osc);
+            osc += AxisMath::sinCycles (AxisMath::signedCycles (phaseSub[v])) * subGain[v];
+
+            const float driven   = AxisMath::tanh (osc * (preGain[v] + preGainStep[v] * position))
+                                     * (postTrim[v] + postTrimStep[v] * position);
+            const float stressed = AxisMath::tanh (driven * stress[v]);
+
+            // Rotating filter pair (TPT bandpass)
+            const float hpA = hA[v] * (stressed - s1A[v] * (gA[v] + R2A[v]) - s2A[v]);
+            const float bpA = hpA * gA[v] + s1A[v];
+            s1A[v] = hpA * gA[v] + bpA;
+            s2A[v] += 2.0f * bpA * gA[v];
+
+            const float hpB = hB[v] * (stressed - s1B[v] * (gB[v] + R2B[v]) - s2B[v]);
+            const float bpB = hpB * gB[v] + s1B[v];
+            s1B[v] = hpB * gB[v] + bpB;
+            s2B[v] += 2.0f * bpB * gB[v];
+
+            crossModA[v] += 0.001f * (std::abs (bpA) - crossModA[v]);
+            crossModB[v] += 0.001f * (std::abs (bpB) - crossModB[v]);
+
+            float outLeft  = bpA * weightL[v] + bpB * (1.0f - weightL[v]);
+            float outRight = bpA * weightR[v] + bpB * (1.0f - weightR[v]);
+
+            // WEAR post saturation + grit
+            const float drive = diodeDrive[v] + diodeDriveStep[v] * position;
+            outLeft  = AxisMath::diodeClip (outLeft,  drive, drive * asym[v]);
+            outRight = AxisMath::diodeClip (outRight, drive, drive * asym[v]);
+
+            outLeft  += (outLeft  * outLeft  * outLeft  - outLeft)  * gritAmount[v];
+            outRight += (outRight * outRight * outRight - outRight) * gritAmount[v];
+
+            // MASS damping
+            dampL[v] += dampG[v] * (outLeft  - dampL[v]);
+            dampR[v] += dampG[v] * (outRight - dampR[v]);
+
+            // Voice envelope
+            env[v] = juce::jlimit (0.0f, 1.0f, env[v] + envRate[v]);
+            const float gain = env[v] * velocity[v];
+
+            frameL[v] = (outLeft  * (1.0f - dampMix[v]) + dampL[v] * dampMix[v]) * gain;
+            frameR[v] = (outRight * (1.0f - dampMix[v]) + dampR[v] * dampMix[v]) * gain;
+        }
+    }
+}
@@ -0,0 +1,101 @@
+#pragma once
+#include <JuceHeader.h>
+
+// AXIS voice kernel in structure-of-arrays form: up to numLanes independent
+// oscillator stacks + rotating filter pairs, each lane with its own pitch,
+// macros and gate. All per-sample work runs over contiguous lane arrays so
+// it vectorises across lanes. Nothing allocates after prepare().
+class AxisLaneEngine
+{
+public:
+    static constexpr int numLanes = 16;
+    static constexpr int defaultControlInterval = 16;   // samples between cutoff / weight updates
+    static constexpr int torqueBlock = 512;      // samples per AxisEngine torque step at its default block size
+
+    void prepare (double sampleRate, int maxBlockSize);
+    void reset();   // all lanes silent, deterministic seeds
+    void resetLane (int lane);
+
+    void setLaneFrequency (int lane, float hz);
+    void setLaneMacros (int lane, float rotation, float body, float load, float mass, float wear);
+    void setLaneGate (int lane, bool on, float velocity);
+    void openLane (int lane);   // gate on at full level, no attack
+
+    bool isLaneSilent (int lane) const noexcept;
+
+    // Quality tier (see AxisQualityGovernor). The block mappings are rescaled
+    // to the interval every block, so it may change between any two blocks.
+    void setControlInterval (int numSamples) noexcept
+    {
+        controlInterval  = juce::jmax (1, numSamples);
+        controlCountdown = juce::jmin (controlCountdown, controlInterval);
+    }
+
+    // Renders numSamples (<= maxBlockSize) for lanes [0, lanesToRender).
+    // Output is lane-interleaved: frame i of a channel is numLanes floats.
+    void process (int numSamples, int lanesToRender);
+
+    const float* getFrame (int channel, int sampleIndex) const noexcept
+    {
+        return (channel == 0 ? outL : outR).data() + (size_t) sampleIndex * numLanes;
+    }
+
+private:
+    void updateBlockMappings (int numSamples);
+    void updateControl (int lanesToRender);
+
+    template <typename T>
+    using Lanes = std::array<T, numLanes>;
+
+    double sr = 44100.0;
+    int controlInterval = defaultControlInterval;
+    int controlCountdown = 0;
+
+    // ---- Per-lane inputs ----
+    alignas (64) Lanes<float> baseInc {};        // baseFreq / sr in 2^32 phase units
+    alignas (64) Lanes<float> rotation {}, body {}, load {}, mass {}, wear {};
+    alignas (64) Lanes<float> velocity {};
+    alignas (64) Lanes<float> envRate {};        // +attack / -release per sample
+
+    // ---- Per-lane block mappings ----
+    alignas (64) Lanes<float> rotationSmoothed {};
+    alignas (64) Lanes<uint32_t> rotInc {};      // per control step
+    alignas (64) Lanes<float> sweepOctaves {}, baseCentre {};
+    alignas (64) Lanes<float> driftAmount {}, instability {};
+    alignas (64) Lanes<int>   driftInterval {};  // in control steps
+    alignas (64) Lanes<float> smoothA {};        // MASS inertia per control step
+    alignas (64) Lanes<float> crossAmount {};
+    alignas (64) Lanes<float> R2A {}, R2B {};
+    alignas (64) Lanes<float> foldAmount {}, fold2 {}, bodyHigh {}, stress {};
+    alignas (64) Lanes<float> subGain {}, asym {}, gritAmount {};
+    alignas (64) Lanes<float> dampMix {}, dampG {}, width {};
+
+    // LOAD drive / trim and WEAR diode drive ramp across each block from the
+    // last block's values, like AxisEngine's: value after n samples is
+    // start + step * n. A retriggered lane starts on its own values.
+    alignas (64) Lanes<float> preGain {}, postTrim {}, diodeDrive {};
+    alignas (64) Lanes<float> preGainStep {}, postTrimStep {}, diodeDriveStep {};
+    alignas (64) Lanes<float> lastPreGain {}, lastPostTrim {}, lastDiodeDrive {};
+    Lanes<bool> settleRamps {};
+
+    // ---- Per-lane state ----
+    alignas (64) Lanes<uint32_t> phaseA {}, phaseB {}, phaseSub {};   // fixed-point, wrap on overflow
+    alignas (64) Lanes<uint32_t> spectralPhase {};
+    alignas (64) Lanes<float> driftA {}, driftB {}, driftTargetA {}, driftTargetB {};
+    alignas (64) Lanes<int>   driftCountdown {};
+    alignas (64) Lanes<uint32_t> seed {};
+    alignas (64) Lanes<float> smoothedFcA {}, smoothedFcB {};
+    alignas (64) Lanes<float> crossModA {}, crossModB {};
+    alignas (64) Lanes<float> env {};
+
+    // Control-rate filter coefficients (TPT SVF, same maths as juce::dsp::StateVariableTPTFilter)
+    alignas (64) Lanes<float> gA {}, hA {}, gB {}, hB {};
+    alignas (64) Lanes<float> weightL {}, weightR {};
+
+    // Filter state. L/R filters of a voice see identical input and coefficients,
+    // so one A/B pair per lane gives the same result as AxisEngine's four.
+    alignas (64) Lanes<float> s1A {}, s2A {}, s1B {}, s2B {};
+    alignas (64) Lanes<float> dampL {}, dampR {};
+
+    std::vector<float> outL, outR;
+};
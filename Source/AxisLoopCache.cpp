@@ -0,0 +1,78 @@
+#include "AxisLoopCache.h"
+
+void AxisLoopCache::prepare (double sampleRate, int maxBlockSize, int numChannels)
+{
+    sr = sampleRate;
+
+    settleSamples = juce::roundToInt (sr);
+    fadeSamples   = juce::roundToInt (sr * 0.25);
+
+    // Longest window + loop crossfade + one block of overshoot
+    const int capacity = juce::roundToInt (sr * maxWindowSeconds) + fadeSamples + juce::jmax (1, maxBlockSize);
+    cache.setSize (juce::jlimit (1, maxChannels, numChannels), capacity);
+
+    // Equal-power fade shared by the loop bake and the live crossfades; the
+    // falling half is the same table read backwards (cos (a) = sin (pi/2 - a))
+    fadeCurve.resize ((size_t) fadeSamples + 1);
+
+    for (int j = 0; j <= fadeSamples; ++j)
+        fadeCurve[(size_t) j] = std::sin ((float) j / (float) fadeSamples * juce::MathConstants<float>::halfPi);
+
+    fadeLive.resize ((size_t) fadeSamples);
+    fadeLoop.resize ((size_t) fadeSamples);
+
+    reset();
+}
+
+void AxisLoopCache::reset()
+{
+    state = State::live;
+    stillSamples = 0;
+    recordLength = 0;
+    fadeToLiveRemaining = 0;
+    fadeToLoopRemaining = 0;
+    loopStart = loopEnd = playPos = 0;
+}
+
+void AxisLoopCache::setWindowSeconds (float seconds) noexcept
+{
+    windowSamples = juce::roundToInt (sr * juce::jlimit (1.0, maxWindowSeconds, (double) seconds));
+}
+
+void AxisLoopCache::bakeLoop()
+{
+    // Recorded r[0 .. N). The loop plays r[X .. N) where X is the crossfade
+    // length; its last X samples are blended (equal power) into r[0 .. X),
+    // so the wrap from r[N - 1] back to r[X] is seamless. Live rendering
+    // carries on under the first X samples of playback to hide the entry.
+    const int X = fadeSamples;
+    const int N = recordLength;
+
+    if (N < 2 * X)
+    {
+        // Block too long for the cache, or a tiny window: keep running live
+        state = State::live;
+        stillSamples = 0;
+        return;
+    }
+
+    for (int ch = 0; ch < cache.getNumChannels(); ++ch)
+    {
+        auto* data = cache.getWritePointer (ch);
+
+        for (int i = 0; i < X; ++i)
+        {
+            const int tail = N - X + i;
+
+            data[tail] = data[tail] * fadeCurve[(size_t) (X - 1 - i)] + data[i] * fadeCurve[(size_t) (i + 1)];
+        }
+    }
+
+    loopStart = X;
+    loopEnd   = N;
+    playPos   = X;
+    state     = State::playing;
+
+    fadeToLoopRemaining = X;
+    fadeToLiveRemaining = 0;
+}
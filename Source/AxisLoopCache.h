@@ -0,0 +1,185 @@
+#pragma once
+#include <JuceHeader.h>
+
+// "Eco freeze": once every parameter has been still for a while, records a
+// window of the live output, bakes a crossfaded loop point into it and plays
+// the loop back instead of running the engine. The moment anything moves,
+// live rendering resumes under a short crossfade from the loop.
+class AxisLoopCache
+{
+public:
+    static constexpr double maxWindowSeconds = 12.0;
+    static constexpr int maxChannels = 16;     // up to 3rd order ambisonics
+
+    // Allocates the cache for the longest window
+    void prepare (double sampleRate, int maxBlockSize, int numChannels);
+    void reset();
+
+    void setEnabled (bool shouldBeEnabled) noexcept    { enabled = shouldBeEnabled; }
+    void setWindowSeconds (float seconds) noexcept;
+
+    bool isPlayingLoop() const noexcept   { return state == State::playing; }
+
+    // renderLive (juce::AudioBuffer<SampleType>&) produces the live output;
+    // it is skipped entirely while the loop is playing.
+    template <typename SampleType, typename RenderFn>
+    void process (juce::AudioBuffer<SampleType>& buffer, bool somethingMoved, RenderFn&& renderLive)
+    {
+        const int numSamples = buffer.getNumSamples();
+
+        if (! enabled || somethingMoved)
+        {
+            const bool wasPlaying = state == State::playing;
+
+            state = State::live;
+            stillSamples = 0;
+
+            renderLive (buffer);
+
+            // Fade out of the loop over the live output
+            if (wasPlaying)
+                fadeToLiveRemaining = fadeSamples - fadeToLoopRemaining;
+
+            fadeToLoopRemaining = 0;
+
+            if (fadeToLiveRemaining > 0)
+                mixLoopFade (buffer, fadeToLiveRemaining, true);
+
+            return;
+        }
+
+        if (state == State::playing)
+        {
+            // The engine only keeps running while the loop fades in
+            if (fadeToLoopRemaining > 0)
+            {
+                renderLive (buffer);
+                mixLoopFade (buffer, fadeToLoopRemaining, false);
+            }
+            else
+            {
+                readLoop (buffer, 0, numSamples, nullptr);
+            }
+
+            return;
+        }
+
+        renderLive (buffer);
+
+        if (fadeToLiveRemaining > 0)
+            mixLoopFade (buffer, fadeToLiveRemaining, true);
+
+        if (state == State::live)
+        {
+            stillSamples += numSamples;
+
+            if (stillSamples >= settleSamples)
+            {
+                state = State::recording;
+                recordLength = 0;
+            }
+
+            return;
+        }
+
+        // Recording
+        const int numCh = juce::jmin (buffer.getNumChannels(), cache.getNumChannels());
+        const int num   = juce::jmin (numSamples, cache.getNumSamples() - recordLength);
+
+        for (int ch = 0; ch < numCh; ++ch)
+        {
+            const auto* src = buffer.getReadPointer (ch);
+            auto* dst = cache.getWritePointer (ch, recordLength);
+
+            for (int i = 0; i < num; ++i)
+                dst[i] = (float) src[i];
+        }
+
+        recordLength += num;
+
+        if (recordLength >= windowSamples + fadeSamples || num < numSamples)
+            bakeLoop();
+    }
+
+private:
+    enum class State { live, recording, playing };
+
+    void bakeLoop();
+
+    // Copies loop samples into buffer; with a gain ramp when fadeGains != nullptr
+    template <typename SampleType>
+    void readLoop (juce::AudioBuffer<SampleType>& buffer, int startSample, int numSamples, const float* fadeGains)
+    {
+        const int numCh = buffer.getNumChannels();
+
+        for (int i = startSample; i < startSample + numSamples; ++i)
+        {
+            const float gain = fadeGains != nullptr ? fadeGains[i - startSample] : 1.0f;
+
+            for (int ch = 0; ch < numCh; ++ch)
+            {
+                const float s = cache.getSample (juce::jmin (ch, cache.getNumChannels() - 1), playPos);
+
+                if (fadeGains != nullptr)
+                    buffer.getWritePointer (ch)[i] += (SampleType) (s * gain);
+                else
+                    buffer.getWritePointer (ch)[i] = (SampleType) s;
+            }
+
+            if (++playPos >= loopEnd)
+                playPos = loopStart;
+        }
+    }
+
+    // Equal-power crossfade between the loop and the (already rendered) live
+    // block, towards live or towards the loop; the rest of the block after
+    // the fade is pure live / pure loop
+    template <typename SampleType>
+    void mixLoopFade (juce::AudioBuffer<SampleType>& buffer, int& remaining, bool towardsLive)
+    {
+        const int numSamples = buffer.getNumSamples();
+        const int num = juce::jmin (numSamples, remaining);
+
+        for (int i = 0; i < num; ++i)
+        {
+            const auto rising  = (size_t) (fadeSamples - remaining + i);
+            const auto falling = (size_t) (remaining - i);
+
+            fadeLive[(size_t) i] = fadeCurve[towardsLive ? rising : falling];
+            fadeLoop[(size_t) i] = fadeCurve[towardsLive ? falling : rising];
+        }
+
+        for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
+        {
+            auto* data = buffer.getWritePointer (ch);
+
+            for (int i = 0; i < num; ++i)
+                data[i] *= (SampleType) fadeLive[(size_t) i];
+        }
+
+        readLoop (buffer, 0, num, fadeLoop.data());
+        remaining -= num;
+
+        if (! towardsLive && num < numSamples)
+            readLoop (buffer, num, numSamples - num, nullptr);
+    }
+
+    juce::AudioBuffer<float> cache;
+    std::vector<float> fadeCurve;          // sin (j / fadeSamples * pi / 2), j = 0 .. fadeSamples
+    std::vector<float> fadeLive, fadeLoop;
+
+    double sr = 44100.0;
+    bool enabled = false;
+    State state = State::live;
+
+    int settleSamples = 44100;    // parameters still for this long before recording
+    int fadeSamples = 11025;      // loop point and return-to-live crossfade
+    int windowSamples = 44100 * 6;
+
+    int stillSamples = 0;
+    int recordLength = 0;
+
+    int loopStart = 0, loopEnd = 0, playPos = 0;
+    int fadeToLiveRemaining = 0;
+    int fadeToLoopRemaining = 0;
+};
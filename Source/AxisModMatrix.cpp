@@ -0,0 +1,119 @@
+#include "AxisModMatrix.h"
+#include "AxisPhase.h"
+
+void AxisModMatrix::prepare (double sampleRate)
+{
+    sr = sampleRate;
+    reset();
+}
+
+void AxisModMatrix::reset()
+{
+    lfo1Phase = lfo2Phase = 0;
+
+    random.setSeed (0x4d4f4458);
+    randomCountdown = 0.0;
+    randomTarget = randomValue = 0.0f;
+
+    inputLevel = envelopeValue = 0.0f;
+
+    values.fill (0.0f);
+    offsets.fill (0.0f);
+}
+
+void AxisModMatrix::setRoute (int slot, int source, int target, float depth)
+{
+    auto& route = routes[(size_t) slot];
+
+    if (route.source == source && route.target == target && route.depth == depth)
+        return;
+
+    route = { source, target, depth };
+    routesChanged = true;
+}
+
+void AxisModMatrix::setRates (float lfo1Hz, float lfo2Hz, float randomHz)
+{
+    lfo1Rate   = juce::jmin (lfo1Hz, maxRateHz);
+    lfo2Rate   = juce::jmin (lfo2Hz, maxRateHz);
+    randomRate = juce::jmin (randomHz, maxRateHz);
+}
+
+void AxisModMatrix::rebuildDepths()
+{
+    routesChanged = false;
+    active = false;
+
+    for (auto& column : depths)
+        column.fill (0.0f);
+
+    for (const auto& route : routes)
+    {
+        if (route.source == none || route.depth == 0.0f)
+            continue;
+
+        depths[(size_t) route.source - 1][(size_t) route.target] += route.depth;
+        active = true;
+    }
+}
+
+template <typename SampleType>
+void AxisModMatrix::analyseInput (const juce::AudioBuffer<SampleType>& buffer)
+{
+    float level = 0.0f;
+
+    for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
+        level = juce::jmax (level, (float) buffer.getRMSLevel (ch, 0, buffer.getNumSamples()));
+
+    inputLevel = level;
+}
+
+void AxisModMatrix::process (int numSamples)
+{
+    if (routesChanged)
+        rebuildDepths();
+
+    if (! active || numSamples <= 0)
+    {
+        offsets.fill (0.0f);
+        return;
+    }
+
+    // ---- Sources (bipolar except the envelope) ----
+    values[(size_t) lfo1 - 1] = AxisPhase::sine<float> (lfo1Phase);
+    lfo1Phase += AxisPhase::increment32 (lfo1Rate, sr) * (juce::uint32) numSamples;
+
+    // Triangle
+    const float t = (float) lfo2Phase / (float) AxisPhase::cycle32;
+    values[(size_t) lfo2 - 1] = 1.0f - 4.0f * std::abs (t - 0.5f);
+    lfo2Phase += AxisPhase::increment32 (lfo2Rate, sr) * (juce::uint32) numSamples;
+
+    // Random walk: a new target every 1 / rate seconds, glided towards
+    randomCountdown -= numSamples;
+
+    if (randomCountdown <= 0.0)
+    {
+        randomCountdown += sr / juce::jmax (0.01, randomRate);
+        randomTarget = random.nextFloat() * 2.0f - 1.0f;
+    }
+
+    const float blockSeconds = (float) (numSamples / sr);
+    const float glide = 1.0f - std::exp (-blockSeconds * (float) randomRate * 4.0f);
+    randomValue += glide * (randomTarget - randomValue);
+    values[(size_t) randomWalk - 1] = randomValue;
+
+    // Input envelope: 10 ms attack, 200 ms release, per block
+    const float tau = inputLevel > envelopeValue ? 0.01f : 0.2f;
+    envelopeValue += (1.0f - std::exp (-blockSeconds / tau)) * (inputLevel - envelopeValue);
+    values[(size_t) envelope - 1] = juce::jlimit (0.0f, 1.0f, envelopeValue * 2.0f);
+
+    // ---- Matrix: offsets = sum over sources of value * depth column ----
+    offsets.fill (0.0f);
+
+    for (size_t s = 0; s < (size_t) numSources; ++s)
+        if (values[s] != 0.0f)
+            juce::FloatVectorOperations::addWithMultiply (offsets.data(), depths[s].data(), values[s], numTargets);
+}
+
+template void AxisModMatrix::analyseInput<float> (const juce::AudioBuffer<float>&);
+template void AxisModMatrix::analyseInput<double> (const juce::AudioBuffer<double>&);
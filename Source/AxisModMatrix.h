@@ -0,0 +1,69 @@
+#pragma once
+#include <JuceHeader.h>
+
+// Small modulation matrix evaluated once per block (control rate). Four
+// sources - two LFOs, a smoothed random walk and an input envelope - are
+// routed through four slots to the five macros and three engine internals.
+// Routing is folded into one depth column per source (SoA), so evaluation is
+// a vectorised multiply-add per source and no per-sample or virtual calls.
+class AxisModMatrix
+{
+public:
+    enum Source { none = 0, lfo1, lfo2, randomWalk, envelope, numSourceChoices };
+    static constexpr int numSources = numSourceChoices - 1;
+
+    enum Target
+    {
+        rotationTarget = 0, massTarget, bodyTarget, loadTarget, wearTarget,   // AxisPreset::Macro order
+        centreTarget,     // filter centre, octaves
+        sweepTarget,      // sweep depth, relative
+        widthTarget,      // stereo width
+        numTargets
+    };
+
+    static constexpr int numSlots = 4;
+    static constexpr float maxRateHz = 5.0f;   // block-rate sources alias above this
+
+    void prepare (double sampleRate);
+    void reset();
+
+    void setRoute (int slot, int source, int target, float depth);
+    void setRates (float lfo1Hz, float lfo2Hz, float randomHz);
+
+    bool isActive() const noexcept   { return active; }
+
+    // Input level for the envelope source, before the engine overwrites it
+    template <typename SampleType>
+    void analyseInput (const juce::AudioBuffer<SampleType>& buffer);
+
+    // Advances the sources by numSamples and recomputes all target offsets
+    void process (int numSamples);
+
+    float getOffset (Target target) const noexcept   { return offsets[(size_t) target]; }
+
+private:
+    void rebuildDepths();
+
+    double sr = 44100.0;
+
+    struct Route { int source = none; int target = rotationTarget; float depth = 0.0f; };
+    std::array<Route, numSlots> routes {};
+    bool routesChanged = true;
+    bool active = false;
+
+    // Depth of every target for each source (one contiguous column per source)
+    alignas (16) std::array<std::array<float, numTargets>, numSources> depths {};
+    alignas (16) std::array<float, numTargets> offsets {};
+    std::array<float, numSources> values {};
+
+    // Sources
+    juce::uint32 lfo1Phase = 0, lfo2Phase = 0;
+    double lfo1Rate = 0.2, lfo2Rate = 0.07, randomRate = 0.5;
+
+    juce::Random random;
+    double randomCountdown = 0.0;
+    float randomTarget = 0.0f, randomValue = 0.0f;
+
+    float inputLevel = 0.0f;
+    float envelopeValue = 0.0f;
+};
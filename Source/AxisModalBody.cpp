@@ -0,0 +1,167 @@
+#include "AxisModalBody.h"
+
+template <typename SampleType>
+void AxisModalBody<SampleType>::prepare (double sampleRate)
+{
+    sr = sampleRate;
+
+    // Fixed pseudo-random detune / placement, so the body sounds the same every time
+    juce::Random rng (0x41584953);
+
+    for (size_t k = 0; k < (size_t) maxModes; ++k)
+    {
+        jitter[k] = rng.nextFloat() * 2.0f - 1.0f;
+
+        const float angle = juce::MathConstants<float>::pi * (0.25f + 0.2f * (rng.nextFloat() * 2.0f - 1.0f));
+        panL[k] = (SampleType) std::cos (angle);
+        panR[k] = (SampleType) std::sin (angle);
+    }
+
+    // Force a recompute for the new rate
+    body = mass = -1.0f;
+    reset();
+}
+
+template <typename SampleType>
+void AxisModalBody<SampleType>::reset()
+{
+    y1.fill (0);
+    y2.fill (0);
+}
+
+template <typename SampleType>
+void AxisModalBody<SampleType>::setNumModes (int newNumModes)
+{
+    newNumModes = newNumModes <= 0 ? 0 : juce::jlimit (modeBlock, maxModes, (newNumModes + modeBlock - 1) & ~(modeBlock - 1));
+
+    if (newNumModes == numModes)
+        return;
+
+    // Modes coming into the bank start from rest
+    for (size_t k = (size_t) numModes; k < (size_t) newNumModes; ++k)
+        y1[k] = y2[k] = 0;
+
+    numModes = newNumModes;
+    updateCoefficients();
+}
+
+template <typename SampleType>
+void AxisModalBody<SampleType>::setShape (float newBody, float newMass)
+{
+    if (newBody == body && newMass == mass)
+        return;
+
+    body = newBody;
+    mass = newMass;
+    updateCoefficients();
+}
+
+template <typename SampleType>
+void AxisModalBody<SampleType>::setMix (float newMix)
+{
+    mix = juce::jlimit (0.0f, 1.0f, newMix);
+}
+
+template <typename SampleType>
+void AxisModalBody<SampleType>::updateCoefficients()
+{
+    if (numModes == 0 || body < 0.0f)
+    {
+        activeModes = 0;
+        return;
+    }
+
+    // BODY: fundamental + stretch of the partial series (harmonic -> plate-like)
+    const double f0      = juce::jmap ((double) body, 55.0, 220.0);
+    const double stretch = 1.0 + 0.5 * body;
+
+    // MASS: heavier bodies ring longer and lose less in the highs
+    const double t60Base  = juce::jmap ((double) mass, 0.08, 1.5);
+    const double highLoss = juce::jmap ((double) mass, 0.004, 0.001);
+
+    const double nyquistGuard = sr * 0.45;
+
+    // Unit peak gain per mode, 1/sqrt(k) spectral tilt, normalised over the bank
+    double norm = 0.0;
+
+    for (int k = 1; k <= numModes; ++k)
+        norm += 1.0 / k;
+
+    const double bankGain = 1.0 / std::sqrt (norm);
+
+    int lastActive = 0;
+
+    for (size_t k = 0; k < (size_t) numModes; ++k)
+    {
+        const double freq = f0 * std::pow ((double) (k + 1), stretch) * (1.0 + 0.015 * jitter[k]);
+
+        if (freq >= nyquistGuard)
+        {
+            a1[k] = a2[k] = b[k] = 0;
+            continue;
+        }
+
+        lastActive = (int) k + 1;
+
+        const double w   = juce::MathConstants<double>::twoPi * freq / sr;
+        const double t60 = t60Base / (1.0 + highLoss * freq);
+        const double r   = std::exp (-6.907755 / (t60 * sr));   // -60 dB after t60
+
+        a1[k] = (SampleType) (2.0 * r * std::cos (w));
+        a2[k] = (SampleType) (r * r);
+
+        // |H (w)| = b / ((1 - r) |1 - r e^-2jw|), so this b puts the resonance peak at unity
+        const double peakNorm = (1.0 - r) * std::sqrt (1.0 - 2.0 * r * std::cos (2.0 * w) + r * r);
+
+        b[k]  = (SampleType) (peakNorm * bankGain / std::sqrt ((double) (k + 1)));
+    }
+
+    activeModes = (lastActive + modeBlock - 1) & ~(modeBlock - 1);
+}
+
+template <typename SampleType>
+void AxisModalBody<SampleType>::process (SampleType* left, SampleType* right, int numSamples)
+{
+    if (! isActive() || activeModes == 0)
+        return;
+
+    const auto wet = (SampleType) mix;
+
+    for (int i = 0; i < numSamples; ++i)
+    {
+        const SampleType x = (SampleType) 0.5 * (left[i] + right[i]);
+
+        // One partial sum per position within a mode block, so the whole
+        // update is element-wise and vectorises; folded once per sample
+        alignas (64) std::array<SampleType, modeBlock> accL {}, accR {};
+
+        for (size_t m = 0; m < (size_t) activeModes; m += modeBlock)
+        {
+            for (size_t j = 0; j < (size_t) modeBlock; ++j)
+            {
+                const size_t k = m + j;
+                const SampleType y = a1[k] * y1[k] - a2[k] * y2[k] + b[k] * x;
+
+                y2[k] = y1[k];
+                y1[k] = y;
+
+                accL[j] += y * panL[k];
+                accR[j] += y * panR[k];
+            }
+        }
+
+        SampleType sumL = 0, sumR = 0;
+
+        for (size_t j = 0; j < (size_t) modeBlock; ++j)
+        {
+            sumL += accL[j];
+            sumR += accR[j];
+        }
+
+        left[i]  += sumL * wet;
+        right[i] += sumR * wet;
+    }
+}
+
+template class AxisModalBody<float>;
+template class AxisModalBody<double>;
@@ -0,0 +1,49 @@
+#pragma once
+#include <JuceHeader.h>
+
+// Modal "body": a bank of damped two-pole resonators excited by the filter
+// network. BODY sets the fundamental and inharmonicity, MASS the decay.
+// Modes are stored SoA and updated modeBlock at a time so the inner loop
+// vectorises; coefficients are only recomputed when BODY / MASS change.
+template <typename SampleType>
+class AxisModalBody
+{
+public:
+    static constexpr int maxModes  = 256;
+    static constexpr int modeBlock = 8;
+
+    void prepare (double sampleRate);
+    void reset();
+
+    // 0 = off, otherwise 32..256 (rounded to a multiple of modeBlock)
+    void setNumModes (int newNumModes);
+    void setShape (float body, float mass);
+    void setMix (float newMix);
+
+    bool isActive() const noexcept   { return numModes > 0 && mix > 0.0f; }
+
+    // Adds the resonated signal to left / right in place
+    void process (SampleType* left, SampleType* right, int numSamples);
+
+private:
+    void updateCoefficients();
+
+    template <typename T>
+    using Modes = std::array<T, maxModes>;
+
+    double sr = 44100.0;
+
+    int numModes = 0;
+    int activeModes = 0;        // modes below the Nyquist guard, rounded up to modeBlock
+    float mix = 0.0f;
+
+    float body = -1.0f, mass = -1.0f;
+
+    // Fixed per-mode character (set once in prepare)
+    alignas (64) Modes<float> jitter {};
+    alignas (64) Modes<SampleType> panL {}, panR {};
+
+    // Resonator coefficients and state
+    alignas (64) Modes<SampleType> a1 {}, a2 {}, b {};
+    alignas (64) Modes<SampleType> y1 {}, y2 {};
+};
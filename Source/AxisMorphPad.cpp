@@ -0,0 +1,92 @@
+#include "AxisMorphPad.h"
+
+AxisMorphPad::AxisMorphPad (AXISAudioProcessor& p)
+    : processor (p),
+      xAttachment (*p.apvts.getParameter ("MORPH_X"), [this] (float v) { morphX = v; repaint(); }, nullptr),
+      yAttachment (*p.apvts.getParameter ("MORPH_Y"), [this] (float v) { morphY = v; repaint(); }, nullptr)
+{
+    xAttachment.sendInitialUpdate();
+    yAttachment.sendInitialUpdate();
+
+    setMouseCursor (juce::MouseCursor::CrosshairCursor);
+}
+
+juce::Rectangle<float> AxisMorphPad::getPadArea() const
+{
+    return getLocalBounds().toFloat().reduced (4.0f);
+}
+
+juce::Point<float> AxisMorphPad::toPad (juce::Point<float> position) const
+{
+    const auto area = getPadArea();
+
+    return { juce::jlimit (0.0f, 1.0f, (position.x - area.getX()) / area.getWidth()),
+             juce::jlimit (0.0f, 1.0f, (position.y - area.getY()) / area.getHeight()) };
+}
+
+int AxisMorphPad::getCornerAt (juce::Point<float> position) const
+{
+    const auto p = toPad (position);
+    return (p.x < 0.5f ? 0 : 1) + (p.y < 0.5f ? 0 : 2);
+}
+
+void AxisMorphPad::mouseDown (const juce::MouseEvent& e)
+{
+    if (e.mods.isShiftDown() || e.mods.isPopupMenu())
+    {
+        processor.storeMorphSnapshot (getCornerAt (e.position));
+        return;
+    }
+
+    dragging = true;
+    xAttachment.beginGesture();
+    yAttachment.beginGesture();
+    mouseDrag (e);
+}
+
+void AxisMorphPad::mouseDrag (const juce::MouseEvent& e)
+{
+    if (! dragging)
+        return;
+
+    const auto p = toPad (e.position);
+
+    xAttachment.setValueAsPartOfGesture (p.x);
+    yAttachment.setValueAsPartOfGesture (p.y);
+}
+
+void AxisMorphPad::mouseUp (const juce::MouseEvent&)
+{
+    if (! dragging)
+        return;
+
+    dragging = false;
+    xAttachment.endGesture();
+    yAttachment.endGesture();
+}
+
+void AxisMorphPad::paint (juce::Graphics& g)
+{
+    const auto bounds = getLocalBounds().toFloat();
+    const auto area = getPadArea();
+
+    g.setColour (juce::Colours::black.withAlpha (0.35f));
+    g.fillRoundedRectangle (bounds, 3.0f);
+
+    // Snapshot corners
+    g.setColour (juce::Colours::white.withAlpha (0.4f));
+
+    for (auto corner : { area.getTopLeft(), area.getTopRight(), area.getBottomLeft(), area.getBottomRight() })
+        g.fillEllipse (juce::Rectangle<float> (4.0f, 4.0f).withCentre (corner));
+
+    // Morph position
+    const juce::Point<float> position { area.getX() + morphX * area.getWidth(),
+                                        area.getY() + morphY * area.getHeight() };
+
+    g.setColour (juce::Colours::white.withAlpha (0.15f));
+    g.drawHorizontalLine (juce::roundToInt (position.y), area.getX(), area.getRight());
+    g.drawVerticalLine (juce::roundToInt (position.x), area.getY(), area.getBottom());
+
+    g.setColour (juce::Colours::white.withAlpha (0.8f));
+    g.fillEllipse (juce::Rectangle<float> (7.0f, 7.0f).withCentre (position));
+}
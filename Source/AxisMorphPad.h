@@ -0,0 +1,31 @@
+#pragma once
+#include <JuceHeader.h>
+#include "PluginProcessor.h"
+
+// XY pad for MORPH_X / MORPH_Y. Dragging moves the morph position (as one
+// host gesture); shift-click or right-click near a corner stores the current
+// macro settings into that corner's snapshot.
+class AxisMorphPad : public juce::Component
+{
+public:
+    explicit AxisMorphPad (AXISAudioProcessor& p);
+
+    void paint (juce::Graphics&) override;
+    void mouseDown (const juce::MouseEvent&) override;
+    void mouseDrag (const juce::MouseEvent&) override;
+    void mouseUp (const juce::MouseEvent&) override;
+
+private:
+    juce::Rectangle<float> getPadArea() const;
+    juce::Point<float> toPad (juce::Point<float> position) const;
+    int getCornerAt (juce::Point<float> position) const;
+
+    AXISAudioProcessor& processor;
+
+    float morphX = 0.0f, morphY = 0.0f;
+    bool dragging = false;
+
+    juce::ParameterAttachment xAttachment, yAttachment;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (AxisMorphPad)
+};
@@ -0,0 +1,73 @@
+#include "AxisOutputStage.h"
+
+template <typename SampleType>
+void AxisOutputStage<SampleType>::prepare (double sampleRate)
+{
+    // 10 Hz one-pole DC blocker, 80 ms limiter release
+    dcCoeff = (SampleType) (1.0 - juce::MathConstants<double>::twoPi * 10.0 / sampleRate);
+    releaseCoeff = (float) std::exp (-1.0 / (0.08 * sampleRate));
+    kneeStart = juce::Decibels::decibelsToGain (ceilingDb - kneeDb * 0.5f);
+
+    reset();
+}
+
+template <typename SampleType>
+void AxisOutputStage<SampleType>::reset()
+{
+    dcX1 = {};
+    dcY1 = {};
+    gain = 1.0f;
+    blockReductionDb = 0.0f;
+}
+
+template <typename SampleType>
+void AxisOutputStage<SampleType>::process (SampleType* const* channels, int numChannels, int numSamples)
+{
+    const auto numCh = (size_t) juce::jlimit (0, maxChannels, numChannels);
+    float minGain = 1.0f;
+
+    for (int i = 0; i < numSamples; ++i)
+    {
+        Lanes y;
+        SampleType peakLevel = 0;
+
+        // DC blocker, all lanes at once
+        for (size_t c = 0; c < numCh; ++c)
+        {
+            const SampleType x = channels[c][i];
+
+            y[c] = x - dcX1[c] + dcCoeff * dcY1[c];
+            dcX1[c] = x;
+            dcY1[c] = y[c];
+            peakLevel = juce::jmax (peakLevel, std::abs (y[c]));
+        }
+
+        // Soft-knee gain computer on the linked peak (infinite ratio above
+        // the knee); the log maths only runs once the knee is reached
+        const float peak = (float) peakLevel;
+        float target = 1.0f;
+
+        if (peak > kneeStart)
+        {
+            const float over = juce::Decibels::gainToDecibels (peak) - ceilingDb;
+            const float reduction = over >= kneeDb * 0.5f
+                                      ? over
+                                      : (over + kneeDb * 0.5f) * (over + kneeDb * 0.5f) / (2.0f * kneeDb);
+
+            target = juce::Decibels::decibelsToGain (-reduction);
+        }
+
+        // Instant attack, exponential release
+        gain = juce::jmin (target, target + (gain - target) * releaseCoeff);
+        gain = juce::jmin (gain, 1.0f);
+        minGain = juce::jmin (minGain, gain);
+
+        for (size_t c = 0; c < numCh; ++c)
+            channels[c][i] = y[c] * (SampleType) gain;
+    }
+
+    blockReductionDb = -juce::Decibels::gainToDecibels (minGain, -100.0f);
+}
+
+template class AxisOutputStage<float>;
+template class AxisOutputStage<double>;
@@ -0,0 +1,36 @@
+#pragma once
+#include <JuceHeader.h>
+
+// Output safety stage: DC blocker plus a zero-lookahead soft-knee peak
+// limiter. All channels run through the same loops (state kept per channel,
+// contiguous) and share one limiter gain, so the image is preserved on any
+// layout. Attack is instant, so the ceiling holds without lookahead or latency.
+template <typename SampleType>
+class AxisOutputStage
+{
+public:
+    static constexpr float ceilingDb = -1.0f;
+    static constexpr float kneeDb    = 6.0f;
+
+    void prepare (double sampleRate);
+    void reset();
+
+    static constexpr int maxChannels = 16;
+
+    void process (SampleType* const* channels, int numChannels, int numSamples);
+
+    // Largest gain reduction of the last block, dB (positive)
+    float getGainReduction() const noexcept   { return blockReductionDb; }
+
+private:
+    using Lanes = std::array<SampleType, maxChannels>;
+
+    SampleType dcCoeff = (SampleType) 0.9986;
+    Lanes dcX1 {}, dcY1 {};
+
+    float kneeStart = 1.0f;       // linear level where the knee begins
+    float releaseCoeff = 0.0f;
+    float gain = 1.0f;
+
+    float blockReductionDb = 0.0f;
+};
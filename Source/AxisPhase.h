@@ -0,0 +1,108 @@
+#pragma once
+#include <JuceHeader.h>
+
+// Fixed-point phase helpers. A full cycle is 2^32 (oscillators) or 2^64
+// (slow LFOs), so wrapping is free on integer overflow and the top bits
+// index the sine table directly.
+namespace AxisPhase
+{
+    static constexpr int tableBits = 11;
+    static constexpr int tableSize = 1 << tableBits;
+
+    static constexpr double cycle32 = 4294967296.0;             // 2^32
+    static constexpr double cycle64 = 18446744073709551616.0;   // 2^64
+
+    static constexpr juce::uint64 quarter64 = (juce::uint64) 1 << 62;
+
+    // tableSize + 1 entries so interpolation never needs to wrap
+    inline const std::array<double, tableSize + 1>& getSineTable()
+    {
+        static const auto table = []
+        {
+            std::array<double, tableSize + 1> t {};
+
+            for (int i = 0; i <= tableSize; ++i)
+                t[(size_t) i] = std::sin (juce::MathConstants<double>::twoPi * i / tableSize);
+
+            return t;
+        }();
+
+        return table;
+    }
+
+    inline juce::uint32 increment32 (double frequency, double sampleRate)
+    {
+        return (juce::uint32) (juce::int64) (frequency / sampleRate * cycle32);
+    }
+
+    inline juce::uint64 increment64 (double frequency, double sampleRate)
+    {
+        return (juce::uint64) (frequency / sampleRate * cycle64);
+    }
+
+    // Linearly interpolated table sine of a 32-bit phase
+    template <typename T>
+    inline T sine (juce::uint32 phase) noexcept
+    {
+        constexpr int fracBits = 32 - tableBits;
+
+        const auto& table = getSineTable();
+        const auto index  = (size_t) (phase >> fracBits);
+        const auto frac   = (double) (phase & ((1u << fracBits) - 1)) * (1.0 / (double) (1u << fracBits));
+
+        return (T) (table[index] + frac * (table[index + 1] - table[index]));
+    }
+
+    template <typename T>
+    inline T sine (juce::uint64 phase) noexcept
+    {
+        return sine<T> ((juce::uint32) (phase >> 32));
+    }
+
+    inline double toCycles (juce::uint64 phase) noexcept
+    {
+        return (double) phase / cycle64;
+    }
+
+    inline juce::uint64 fromCycles (double cycles) noexcept
+    {
+        cycles -= std::floor (cycles);
+
+        // A tiny negative argument rounds up to exactly 1.0 here, and 2^64
+        // doesn't fit the integer
+        if (cycles >= 1.0)
+            cycles = 0.0;
+
+        return (juce::uint64) (cycles * cycle64);
+    }
+
+    // 32-bit increment scaled by (1 + depth * drift), where drift eases towards
+    // its target by the engine's 0.0005 one-pole every sample. The offset is
+    // kept in 2^-16 phase units and smoothed with integer maths (131 / 2^18),
+    // so the only float -> int conversions happen on a retarget.
+    struct DriftingIncrement
+    {
+        DriftingIncrement (double increment, double depth, float drift, float driftTarget) noexcept
+            : base ((juce::uint32) (juce::int64) increment),
+              scale (increment * depth * 65536.0),
+              offset ((juce::int64) (scale * drift)),
+              target ((juce::int64) (scale * driftTarget))
+        {
+        }
+
+        void retarget (float driftTarget) noexcept
+        {
+            target = (juce::int64) (scale * driftTarget);
+        }
+
+        juce::uint32 next() noexcept
+        {
+            offset += ((target - offset) * 131) >> 18;
+            return base + (juce::uint32) (offset >> 16);
+        }
+
+        juce::uint32 base;
+        double scale;
+        juce::int64 offset, target;
+    };
+}
@@ -0,0 +1,115 @@
+#include "AxisPresetBank.h"
+
+namespace
+{
+    struct FactoryPreset
+    {
+        const char* name;
+        std::array<float, AxisPreset::numMacros> macros;   // rotation, mass, body, load, wear
+        int filters, mode, specSize, modes;                 // choice indices
+        float modalMix, chassis;
+    };
+
+    const FactoryPreset factoryPresets[]
+    {
+        { "Init",              { 0.35f, 0.50f, 0.50f, 0.40f, 0.20f }, 0, 0, 1, 0, 0.5f, 0.0f },
+        { "Slow Turbine",      { 0.15f, 0.80f, 0.40f, 0.30f, 0.10f }, 1, 0, 1, 0, 0.5f, 0.0f },
+        { "Grinding Gearbox",  { 0.55f, 0.40f, 0.60f, 0.80f, 0.60f }, 2, 0, 1, 0, 0.5f, 0.3f },
+        { "Hollow Tank",       { 0.25f, 0.70f, 0.80f, 0.35f, 0.20f }, 0, 0, 1, 2, 0.6f, 0.5f },
+        { "Spectral Drift",    { 0.20f, 0.60f, 0.50f, 0.30f, 0.30f }, 0, 1, 2, 0, 0.5f, 0.0f },
+        { "Worn Bearing",      { 0.45f, 0.30f, 0.35f, 0.50f, 0.85f }, 0, 0, 1, 0, 0.5f, 0.1f },
+        { "Sixteen Blades",    { 0.60f, 0.50f, 0.50f, 0.45f, 0.25f }, 3, 0, 1, 0, 0.5f, 0.0f },
+        { "Resonant Hull",     { 0.30f, 0.55f, 0.70f, 0.40f, 0.15f }, 1, 0, 1, 4, 0.8f, 0.2f }
+    };
+}
+
+AxisPresetBank::AxisPresetBank()
+    : table (createTable())
+{
+}
+
+juce::File AxisPresetBank::getUserPresetDirectory()
+{
+    return juce::File::getSpecialLocation (juce::File::userApplicationDataDirectory)
+               .getChildFile ("AXIS")
+               .getChildFile ("Presets");
+}
+
+AxisPresetBank::Table AxisPresetBank::createFactoryTable()
+{
+    Table factory;
+
+    for (const auto& f : factoryPresets)
+    {
+        AxisPreset preset;
+        preset.name   = f.name;
+        preset.macros = f.macros;
+        preset.settings = { { "FILTERS",     (float) f.filters },
+                            { "MODE",        (float) f.mode },
+                            { "SPECSIZE",    (float) f.specSize },
+                            { "SPECOVERLAP", 1.0f },
+                            { "MODES",       (float) f.modes },
+                            { "MODALMIX",    f.modalMix },
+                            { "CHASSIS",     f.chassis } };
+
+        factory.push_back (std::move (preset));
+    }
+
+    return factory;
+}
+
+bool AxisPresetBank::loadUserPreset (const juce::File& file, AxisPreset& preset)
+{
+    const auto xml = juce::XmlDocument::parse (file);
+
+    if (xml == nullptr || ! xml->hasTagName ("AXISPRESET"))
+        return false;
+
+    preset.name = xml->getStringAttribute ("name", file.getFileNameWithoutExtension());
+
+    for (auto* param : xml->getChildWithTagNameIterator ("PARAM"))
+    {
+        const auto id    = param->getStringAttribute ("id");
+        const auto value = (float) param->getDoubleAttribute ("value");
+
+        const auto macro = std::find_if (AxisPreset::macroIDs.begin(), AxisPreset::macroIDs.end(),
+                                         [&] (const char* macroID) { return id == macroID; });
+
+        if (macro != AxisPreset::macroIDs.end())
+        {
+            preset.macros[(size_t) std::distance (AxisPreset::macroIDs.begin(), macro)] = value;
+            continue;
+        }
+
+        // Same parameter as a factory setting: override it, otherwise add it
+        auto existing = std::find_if (preset.settings.begin(), preset.settings.end(),
+                                      [&] (const auto& s) { return s.first == id; });
+
+        if (existing != preset.settings.end())
+            existing->second = value;
+        else
+            preset.settings.emplace_back (id, value);
+    }
+
+    return true;
+}
+
+AxisPresetBank::Table AxisPresetBank::createTable()
+{
+    auto loaded = createFactoryTable();
+    const auto init = loaded.front();
+
+    auto files = getUserPresetDirectory().findChildFiles (juce::File::findFiles, false, "*.axispreset");
+    files.sort();
+
+    for (const auto& file : files)
+    {
+        // Anything a user preset leaves out comes from Init
+        auto preset = init;
+
+        if (loadUserPreset (file, preset))
+            loaded.push_back (std::move (preset));
+    }
+
+    return loaded;
+}
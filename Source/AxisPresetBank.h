@@ -0,0 +1,41 @@
+#pragma once
+#include <JuceHeader.h>
+
+// One preset: the five macros (read directly by the audio thread on recall)
+// plus the remaining sound-defining parameters as plain values, applied
+// through the parameters on the message thread.
+struct AxisPreset
+{
+    enum Macro { rotation = 0, mass, body, load, wear, numMacros };
+
+    static constexpr std::array<const char*, numMacros> macroIDs { "ROTATION", "MASS", "BODY", "LOAD", "WEAR" };
+
+    juce::String name;
+    std::array<float, numMacros> macros {};
+    std::vector<std::pair<juce::String, float>> settings;   // parameter ID, plain value
+};
+
+// Factory presets plus user presets from disk, read once in the constructor.
+// The table never changes afterwards: hosts get the same program list however
+// early they ask for it, and any thread may read it without locking.
+class AxisPresetBank
+{
+public:
+    using Table = std::vector<AxisPreset>;
+
+    AxisPresetBank();
+
+    const Table& getTable() const noexcept   { return table; }
+
+    // *.axispreset XML files: <AXISPRESET name="..."><PARAM id="..." value="..."/></AXISPRESET>
+    static juce::File getUserPresetDirectory();
+
+private:
+    static Table createTable();
+    static Table createFactoryTable();
+    static bool loadUserPreset (const juce::File& file, AxisPreset& preset);
+
+    const Table table;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (AxisPresetBank)
+};
@@ -0,0 +1,71 @@
+#include "AxisQualityGovernor.h"
+
+namespace
+{
+    constexpr float downThreshold = 0.70f;   // fraction of the block deadline
+    constexpr float upThreshold   = 0.35f;
+    constexpr double downHoldSeconds = 0.05;
+    constexpr double upHoldSeconds   = 2.0;
+}
+
+void AxisQualityGovernor::prepare (double sampleRate)
+{
+    sr = sampleRate;
+
+    reset();
+}
+
+void AxisQualityGovernor::reset()
+{
+    smoothedLoad = 0.0f;
+    blocksAbove = blocksBelow = 0;
+
+    activeTier = full;
+    load = 0.0f;
+}
+
+void AxisQualityGovernor::endBlock (juce::int64 elapsedTicks, int numSamples, bool switching)
+{
+    if (numSamples <= 0 || switching)
+        return;
+
+    const double elapsed  = juce::Time::highResolutionTicksToSeconds (elapsedTicks);
+    const double deadline = numSamples / sr;
+    const float blockLoad = (float) (elapsed / deadline);
+
+    smoothedLoad += 0.2f * (blockLoad - smoothedLoad);
+    load = smoothedLoad;
+
+    const double blockSeconds = deadline;
+    const int tier = activeTier.load();
+
+    if (! enabled)
+    {
+        blocksAbove = blocksBelow = 0;
+        activeTier = full;
+    }
+    else if (smoothedLoad > downThreshold)
+    {
+        blocksBelow = 0;
+
+        if (++blocksAbove * blockSeconds >= downHoldSeconds && tier < numTiers - 1)
+        {
+            activeTier = tier + 1;
+            blocksAbove = 0;
+        }
+    }
+    else if (smoothedLoad < upThreshold)
+    {
+        blocksAbove = 0;
+
+        if (++blocksBelow * blockSeconds >= upHoldSeconds && tier > full)
+        {
+            activeTier = tier - 1;
+            blocksBelow = 0;
+        }
+    }
+    else
+    {
+        blocksAbove = blocksBelow = 0;
+    }
+}
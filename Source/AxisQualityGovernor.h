@@ -0,0 +1,44 @@
+#pragma once
+#include <JuceHeader.h>
+
+// Watches processBlock time against the block deadline and steps the DSP
+// down through quality tiers under CPU pressure, back up with hysteresis
+// when there's headroom. No tier changes the latency, so a tier change
+// never moves the host's delay compensation; the processor crossfades
+// from the old tier to the new one while both render.
+class AxisQualityGovernor
+{
+public:
+    enum Tier
+    {
+        full = 0,
+        controlRate,       // cutoff / coefficient updates at control rate
+        approxShapers,     // + rational tanh
+        numTiers
+    };
+
+    void prepare (double sampleRate);
+    void reset();
+
+    // When disabled the load is still measured, but the tier returns to full
+    void setEnabled (bool shouldBeEnabled) noexcept   { enabled = shouldBeEnabled; }
+
+    // Call with the time spent in processBlock; may change the active tier.
+    // Blocks rendered during a crossfade (two engines) are left out of the
+    // measurement, so a switch can't push the governor down another tier.
+    void endBlock (juce::int64 elapsedTicks, int numSamples, bool switching);
+
+    int getActiveTier() const noexcept   { return activeTier.load(); }
+    float getLoad() const noexcept       { return load.load(); }
+
+private:
+    double sr = 44100.0;
+    bool enabled = false;
+
+    float smoothedLoad = 0.0f;
+    int blocksAbove = 0;
+    int blocksBelow = 0;
+
+    std::atomic<int> activeTier { full };
+    std::atomic<float> load { 0.0f };
+};
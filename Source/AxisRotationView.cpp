@@ -0,0 +1,95 @@
+#include "AxisRotationView.h"
+
+namespace
+{
+    constexpr float minHz = 20.0f;
+    constexpr float maxHz = 18000.0f;
+
+    float frequencyToProportion (float hz)
+    {
+        hz = juce::jlimit (minHz, maxHz, hz);
+        return std::log (hz / minHz) / std::log (maxHz / minHz);
+    }
+}
+
+AxisRotationView::AxisRotationView (AxisTelemetry& source, std::function<float()> reductionSource)
+    : telemetry (source), readReduction (std::move (reductionSource))
+{
+    setInterceptsMouseClicks (false, false);
+}
+
+void AxisRotationView::refresh()
+{
+    const bool changed = telemetry.read (frame);
+
+    // Meter release runs on the display clock so it also falls while
+    // the audio thread is idle
+    const float peak = juce::jmax (frame.peakLeft, frame.peakRight);
+    const float released = displayLevel * 0.9f;
+    const float level = changed ? juce::jmax (peak, released) : released;
+
+    const float reductionReleased = displayReduction * 0.9f;
+    const float reduction = juce::jmax (readReduction(), reductionReleased);
+
+    if (! changed && std::abs (level - displayLevel) < 1.0e-4f && std::abs (reduction - displayReduction) < 1.0e-3f)
+        return;
+
+    displayLevel = level;
+    displayReduction = reduction;
+    repaint();
+}
+
+void AxisRotationView::paint (juce::Graphics& g)
+{
+    auto area = getLocalBounds().toFloat();
+
+    g.setColour (juce::Colours::black.withAlpha (0.35f));
+    g.fillRoundedRectangle (area, 3.0f);
+
+    area.reduce (4.0f, 3.0f);
+
+    // Output level along the bottom edge
+    auto meter = area.removeFromBottom (2.0f);
+    g.setColour (juce::Colours::white.withAlpha (0.5f));
+    g.fillRect (meter.withWidth (meter.getWidth() * juce::jlimit (0.0f, 1.0f, displayLevel)));
+
+    // Limiter gain reduction grows from the right, 12 dB full scale
+    if (displayReduction > 0.01f)
+    {
+        const float width = meter.getWidth() * juce::jlimit (0.0f, 1.0f, displayReduction / 12.0f);
+
+        g.setColour (juce::Colours::orangered.withAlpha (0.8f));
+        g.fillRect (meter.withX (meter.getRight() - width).withWidth (width));
+    }
+
+    area.removeFromBottom (2.0f);
+
+    // Rotation phase along the top edge
+    auto phase = area.removeFromTop (2.0f);
+    g.setColour (juce::Colours::white.withAlpha (0.25f));
+    g.fillRect (phase);
+    g.setColour (juce::Colours::white.withAlpha (0.8f));
+    g.fillRect (phase.withWidth (2.0f).withX (phase.getX() + frame.rotationPhase * (phase.getWidth() - 2.0f)));
+
+    area.removeFromTop (2.0f);
+
+    if (frame.numFilters == 0)
+    {
+        // Spectral mode: the band wraps around the whole axis with the phase
+        const float x = area.getX() + frame.rotationPhase * area.getWidth();
+
+        g.setColour (juce::Colours::white.withAlpha (0.6f));
+        g.drawVerticalLine (juce::roundToInt (x), area.getY(), area.getBottom());
+        return;
+    }
+
+    for (int k = 0; k < frame.numFilters; ++k)
+    {
+        const float x = area.getX() + frequencyToProportion (frame.centres[(size_t) k]) * area.getWidth();
+        const float energy = juce::jlimit (0.0f, 1.0f, frame.crossMod[(size_t) k] * 8.0f);
+        const float size = 3.0f + energy * (area.getHeight() - 3.0f);
+
+        g.setColour (juce::Colours::white.withAlpha (0.35f + 0.5f * energy));
+        g.fillEllipse (juce::Rectangle<float> (size, size).withCentre ({ x, area.getCentreY() }));
+    }
+}
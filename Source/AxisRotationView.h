@@ -0,0 +1,30 @@
+#pragma once
+#include <JuceHeader.h>
+#include "AxisTelemetry.h"
+
+// Live view of the rotation: filter centres on a log-frequency axis (sized
+// by their cross-mod energy), the rotation phase, the output level and the
+// safety limiter's gain reduction.
+// Polls the telemetry channel and the limiter in sync with the display refresh.
+class AxisRotationView : public juce::Component
+{
+public:
+    // readReduction returns the limiter's gain reduction (dB) since the last call
+    AxisRotationView (AxisTelemetry& source, std::function<float()> readReduction);
+
+    void paint (juce::Graphics&) override;
+
+private:
+    void refresh();
+
+    AxisTelemetry& telemetry;
+    std::function<float()> readReduction;
+    AxisTelemetryFrame frame;
+
+    float displayLevel = 0.0f;       // peak meter with release
+    float displayReduction = 0.0f;   // limiter gain reduction, dB, with release
+
+    juce::VBlankAttachment vblank { this, [this] { refresh(); } };
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (AxisRotationView)
+};
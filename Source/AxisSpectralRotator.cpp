@@ -0,0 +1,183 @@
+#include "AxisSpectralRotator.h"
+
+template <typename SampleType>
+void AxisSpectralRotator<SampleType>::prepare (double sampleRate)
+{
+    sr = sampleRate;
+
+    for (int order = minOrder; order <= maxOrder; ++order)
+        if (ffts[(size_t) (order - minOrder)] == nullptr)
+            ffts[(size_t) (order - minOrder)] = std::make_unique<juce::dsp::FFT> (order);
+
+    const size_t maxSize = (size_t) 1 << maxOrder;
+
+    window.resize (maxSize);
+    inputFifo.resize (maxSize);
+    analysis.resize (maxSize * 2);
+    magnitude.resize (maxSize / 2 + 1);
+    rotated.resize (maxSize / 2 + 1);
+    frameL.resize (maxSize * 2);
+    frameR.resize (maxSize * 2);
+    accumL.resize (maxSize);
+    accumR.resize (maxSize);
+
+    // Re-derive window / band for the current resolution
+    const int size = sizeIndex, overlap = overlapIndex;
+    sizeIndex = -1;
+    setResolution (size, overlap);
+}
+
+template <typename SampleType>
+void AxisSpectralRotator<SampleType>::reset()
+{
+    std::fill (inputFifo.begin(), inputFifo.end(), 0.0f);
+    std::fill (accumL.begin(), accumL.end(), 0.0f);
+    std::fill (accumR.begin(), accumR.end(), 0.0f);
+
+    inputPos = 0;
+    outputPos = 0;
+    hopCounter = hopSize;
+}
+
+template <typename SampleType>
+void AxisSpectralRotator<SampleType>::setResolution (int newSizeIndex, int newOverlapIndex)
+{
+    newSizeIndex    = juce::jlimit (0, maxOrder - minOrder, newSizeIndex);
+    newOverlapIndex = juce::jlimit (0, 2, newOverlapIndex);
+
+    if (newSizeIndex == sizeIndex && newOverlapIndex == overlapIndex)
+        return;
+
+    sizeIndex = newSizeIndex;
+    overlapIndex = newOverlapIndex;
+
+    fft     = ffts[(size_t) sizeIndex].get();
+    fftSize = 1 << (minOrder + sizeIndex);
+    hopSize = fftSize >> (1 + overlapIndex);
+
+    // Periodic sqrt-Hann on both sides: the squared window overlap-adds to
+    // fftSize / (2 * hop), so scale that back to unity
+    for (int n = 0; n < fftSize; ++n)
+        window[(size_t) n] = std::sqrt (0.5f - 0.5f * std::cos (juce::MathConstants<float>::twoPi * (float) n / (float) fftSize));
+
+    olaGain = 2.0f * (float) hopSize / (float) fftSize;
+
+    // Rotate between ~40 Hz and ~16 kHz, leaving DC / the top bins alone
+    const double binHz = sr / fftSize;
+    lowBin  = juce::jmax (1, (int) std::ceil (40.0 / binHz));
+    highBin = juce::jlimit (lowBin + 2, fftSize / 2, (int) std::floor (16000.0 / binHz));
+
+    reset();
+}
+
+template <typename SampleType>
+void AxisSpectralRotator<SampleType>::setRotation (float cyclesLeft, float cyclesRight)
+{
+    rotationLeft  = cyclesLeft  - std::floor (cyclesLeft);
+    rotationRight = cyclesRight - std::floor (cyclesRight);
+}
+
+template <typename SampleType>
+void AxisSpectralRotator<SampleType>::rotateInto (float* frame, float shiftCycles)
+{
+    const int band = highBin - lowBin;
+    const float shift = shiftCycles * (float) band;
+
+    // shiftCycles < 1, but the product can still round up to band
+    const int whole  = juce::jmin ((int) shift, band - 1);
+    const float frac = shift - (float) whole;
+
+    // Source position for bin k is k - shift (circular within the band); the
+    // wrap is handled by splitting the band into two contiguous runs, with the
+    // one bin whose lower neighbour wraps peeled out, so the interpolation
+    // loops are branch-free and vectorise
+    const float* mag = magnitude.data() + lowBin;
+    float* out = rotated.data() + lowBin;
+
+    auto interpolateRun = [&] (int destStart, int destEnd, int srcOffset)
+    {
+        for (int k = destStart; k < destEnd; ++k)
+        {
+            const int s0 = k + srcOffset;
+            out[k] = mag[s0] * (1.0f - frac) + mag[s0 - 1] * frac;
+        }
+    };
+
+    // dest k takes src (k - whole) mod band, blended towards the bin below it
+    interpolateRun (0, whole, band - whole);
+    out[whole] = mag[0] * (1.0f - frac) + mag[band - 1] * frac;
+    interpolateRun (whole + 1, band, -whole);
+
+    // Apply rotated magnitude as a gain on each bin, keeping its phase
+    auto* bins = reinterpret_cast<std::complex<float>*> (frame);
+
+    for (int k = lowBin; k < highBin; ++k)
+    {
+        const float gain = rotated[(size_t) k] / (magnitude[(size_t) k] + 1.0e-9f);
+        bins[k] *= gain;
+    }
+}
+
+template <typename SampleType>
+void AxisSpectralRotator<SampleType>::processFrame()
+{
+    // Unwrap the circular input buffer into the windowed analysis frame
+    for (int n = 0; n < fftSize; ++n)
+        analysis[(size_t) n] = inputFifo[(size_t) ((inputPos + n) & (fftSize - 1))] * window[(size_t) n];
+
+    std::fill (analysis.begin() + fftSize, analysis.begin() + 2 * fftSize, 0.0f);
+
+    fft->performRealOnlyForwardTransform (analysis.data(), true);
+
+    const auto* bins = reinterpret_cast<const std::complex<float>*> (analysis.data());
+
+    for (int k = 0; k <= fftSize / 2; ++k)
+        magnitude[(size_t) k] = std::abs (bins[k]);
+
+    std::copy (analysis.begin(), analysis.begin() + 2 * fftSize, frameL.begin());
+    std::copy (analysis.begin(), analysis.begin() + 2 * fftSize, frameR.begin());
+
+    rotateInto (frameL.data(), rotationLeft);
+    rotateInto (frameR.data(), rotationRight);
+
+    fft->performRealOnlyInverseTransform (frameL.data());
+    fft->performRealOnlyInverseTransform (frameR.data());
+
+    // Overlap-add, starting at the current output position
+    for (int n = 0; n < fftSize; ++n)
+    {
+        const auto pos = (size_t) ((outputPos + n) & (fftSize - 1));
+        const float w = window[(size_t) n] * olaGain;
+
+        accumL[pos] += frameL[(size_t) n] * w;
+        accumR[pos] += frameR[(size_t) n] * w;
+    }
+}
+
+template <typename SampleType>
+void AxisSpectralRotator<SampleType>::process (const SampleType* input, SampleType* left, SampleType* right, int numSamples)
+{
+    for (int i = 0; i < numSamples; ++i)
+    {
+        inputFifo[(size_t) inputPos] = (float) input[i];
+        inputPos = (inputPos + 1) & (fftSize - 1);
+
+        if (--hopCounter <= 0)
+        {
+            hopCounter = hopSize;
+            processFrame();
+        }
+
+        // Emit the oldest finished sample and clear its slot for reuse
+        const auto pos = (size_t) outputPos;
+
+        left[i]  = (SampleType) accumL[pos];
+        right[i] = (SampleType) accumR[pos];
+
+        accumL[pos] = accumR[pos] = 0.0f;
+        outputPos = (outputPos + 1) & (fftSize - 1);
+    }
+}
+
+template class AxisSpectralRotator<float>;
+template class AxisSpectralRotator<double>;
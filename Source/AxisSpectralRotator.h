@@ -0,0 +1,57 @@
+#pragma once
+#include <JuceHeader.h>
+
+// STFT "true" spectral rotation: magnitudes inside a band are circularly
+// rotated by a fraction of the band width, phases stay with their bins.
+// Sqrt-Hann analysis / synthesis with overlap-add. Every buffer and FFT is
+// allocated in prepare; changing frame size / overlap later only resets.
+template <typename SampleType>
+class AxisSpectralRotator
+{
+public:
+    static constexpr int minOrder = 9;    // 512
+    static constexpr int maxOrder = 11;   // 2048
+
+    void prepare (double sampleRate);
+    void reset();
+
+    // sizeIndex: 0 = 512, 1 = 1024, 2 = 2048; overlapIndex: 0 = 2x, 1 = 4x, 2 = 8x
+    void setResolution (int sizeIndex, int overlapIndex);
+
+    // Latency in samples: one frame (the output of a frame starts with its oldest sample)
+    int getLatencySamples() const noexcept   { return fftSize - 1; }
+
+    // Rotation positions in cycles of the band (0..1) for the two outputs
+    void setRotation (float cyclesLeft, float cyclesRight);
+
+    void process (const SampleType* input, SampleType* left, SampleType* right, int numSamples);
+
+private:
+    void processFrame();
+    void rotateInto (float* frame, float shiftCycles);
+
+    double sr = 44100.0;
+
+    std::array<std::unique_ptr<juce::dsp::FFT>, maxOrder - minOrder + 1> ffts;
+    juce::dsp::FFT* fft = nullptr;
+
+    int fftSize = 1024;
+    int hopSize = 256;
+    int sizeIndex = 1, overlapIndex = 1;
+
+    int lowBin = 1, highBin = 512;   // rotated band [lowBin, highBin)
+    float olaGain = 1.0f;
+
+    float rotationLeft = 0.0f, rotationRight = 0.0f;
+
+    std::vector<float> window;
+    std::vector<float> inputFifo;               // last fftSize input samples
+    std::vector<float> analysis;                // windowed frame, 2 * fftSize for the real FFT
+    std::vector<float> magnitude, rotated;
+    std::vector<float> frameL, frameR;          // 2 * fftSize each
+    std::vector<float> accumL, accumR;          // overlap-add accumulators
+
+    int inputPos = 0;       // write position in inputFifo
+    int hopCounter = 0;     // samples until the next frame
+    int outputPos = 0;      // read position in accum
+};
@@ -0,0 +1,62 @@
+#include "AxisSpectrumView.h"
+
+AxisSpectrumView::AxisSpectrumView (AxisAnalyser& source)
+    : analyser (source)
+{
+    setInterceptsMouseClicks (false, false);
+    analyser.setActive (true);
+}
+
+AxisSpectrumView::~AxisSpectrumView()
+{
+    analyser.setActive (false);
+}
+
+void AxisSpectrumView::refresh()
+{
+    if (analyser.read (frame))
+        repaint();
+}
+
+void AxisSpectrumView::paint (juce::Graphics& g)
+{
+    auto area = getLocalBounds().toFloat();
+
+    g.setColour (juce::Colours::black.withAlpha (0.35f));
+    g.fillRoundedRectangle (area, 3.0f);
+
+    area.reduce (4.0f, 3.0f);
+
+    // Scope trace
+    juce::Path scope;
+    const float xStep = area.getWidth() / (float) (AxisAnalyser::scopeSize - 1);
+
+    for (int i = 0; i < AxisAnalyser::scopeSize; ++i)
+    {
+        const float y = area.getCentreY() - juce::jlimit (-1.0f, 1.0f, frame.scope[(size_t) i]) * area.getHeight() * 0.5f;
+
+        if (i == 0)
+            scope.startNewSubPath (area.getX(), y);
+        else
+            scope.lineTo (area.getX() + (float) i * xStep, y);
+    }
+
+    g.setColour (juce::Colours::white.withAlpha (0.2f));
+    g.strokePath (scope, juce::PathStrokeType (1.0f));
+
+    // Spectrum, filled from the bottom edge
+    juce::Path spectrum;
+    const float bandStep = area.getWidth() / (float) (AxisAnalyser::numBands - 1);
+
+    spectrum.startNewSubPath (area.getX(), area.getBottom());
+
+    for (int b = 0; b < AxisAnalyser::numBands; ++b)
+        spectrum.lineTo (area.getX() + (float) b * bandStep,
+                         area.getBottom() - frame.bands[(size_t) b] * area.getHeight());
+
+    spectrum.lineTo (area.getRight(), area.getBottom());
+    spectrum.closeSubPath();
+
+    g.setColour (juce::Colours::white.withAlpha (0.45f));
+    g.fillPath (spectrum);
+}
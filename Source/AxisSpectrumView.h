@@ -0,0 +1,25 @@
+#pragma once
+#include <JuceHeader.h>
+#include "AxisAnalyser.h"
+
+// Output spectrum with the scope trace behind it. Keeps the analyser
+// running for as long as the view exists and redraws on the display
+// refresh whenever a new analysis frame is ready.
+class AxisSpectrumView : public juce::Component
+{
+public:
+    explicit AxisSpectrumView (AxisAnalyser& source);
+    ~AxisSpectrumView() override;
+
+    void paint (juce::Graphics&) override;
+
+private:
+    void refresh();
+
+    AxisAnalyser& analyser;
+    AxisAnalyser::Frame frame;
+
+    juce::VBlankAttachment vblank { this, [this] { refresh(); } };
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (AxisSpectrumView)
+};
@@ -0,0 +1,57 @@
+#pragma once
+#include <JuceHeader.h>
+
+// Single-producer / single-consumer triple buffer. The writer always owns one
+// slot and the reader another; publish() and read() swap through the third
+// with one atomic exchange, so neither side ever blocks or waits on the other.
+template <typename T>
+class AxisTripleBuffer
+{
+public:
+    // Writer: fill the returned slot, then publish()
+    T& getWriteSlot() noexcept   { return slots[(size_t) backIndex]; }
+
+    void publish() noexcept
+    {
+        backIndex = middle.exchange (backIndex | dirtyBit, std::memory_order_acq_rel) & indexMask;
+    }
+
+    // Reader: copies the latest published value, false if nothing new
+    bool read (T& destination) noexcept
+    {
+        if ((middle.load (std::memory_order_relaxed) & dirtyBit) == 0)
+            return false;
+
+        frontIndex = middle.exchange (frontIndex, std::memory_order_acq_rel) & indexMask;
+        destination = slots[(size_t) frontIndex];
+        return true;
+    }
+
+private:
+    static constexpr int indexMask = 3;
+    static constexpr int dirtyBit  = 4;
+
+    std::array<T, 3> slots {};
+    int backIndex  = 0;                 // writer only
+    int frontIndex = 1;                 // reader only
+    std::atomic<int> middle { 2 };
+
+    static_assert (std::is_trivially_copyable_v<T>);
+};
+
+// Engine state published once per processed block for the editor
+struct AxisTelemetryFrame
+{
+    static constexpr int maxFilters = 16;
+
+    float rotationPhase = 0.0f;   // cycles, [0, 1)
+    int   mode = 0;               // AxisEngine::Mode
+    int   numFilters = 0;         // 0 in spectral mode
+
+    std::array<float, maxFilters> centres {};    // smoothed cutoff, Hz
+    std::array<float, maxFilters> crossMod {};   // ring cross-mod energy
+
+    float peakLeft = 0.0f, peakRight = 0.0f;     // engine output, block peak
+};
+
+using AxisTelemetry = AxisTripleBuffer<AxisTelemetryFrame>;
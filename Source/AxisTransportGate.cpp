@@ -0,0 +1,38 @@
+#include "AxisTransportGate.h"
+
+void AxisTransportGate::prepare (double sampleRate)
+{
+    fadeSamples = juce::jmax (1, (int) (sampleRate * 0.02));   // 20 ms each way
+
+    reset();
+}
+
+void AxisTransportGate::reset()
+{
+    state = State::running;
+    resetRequested = false;
+    gain = 1.0f;
+}
+
+bool AxisTransportGate::beginBlock (bool hostIsPlaying) noexcept
+{
+    const bool shouldRun = hostIsPlaying || ! enabled;
+
+    if (shouldRun)
+    {
+        if (state == State::suspended)
+        {
+            // Resume from a known state, faded in from silence
+            resetRequested = true;
+            gain = 0.0f;
+        }
+
+        state = State::running;
+        return true;
+    }
+
+    if (state == State::running)
+        state = State::fadingOut;
+
+    return state != State::suspended;
+}
@@ -0,0 +1,57 @@
+#pragma once
+#include <JuceHeader.h>
+
+// Suspends rendering while the host transport is stopped: fades the output
+// out, then reports that blocks can be skipped (the processor clears them;
+// JUCE's wrappers have no way to raise VST3 / AU silence flags, so the host
+// still sees an ordinary silent buffer). When playback starts again it asks
+// for a deterministic reset and fades back in.
+class AxisTransportGate
+{
+public:
+    void prepare (double sampleRate);
+    void reset();
+
+    void setEnabled (bool shouldBeEnabled) noexcept   { enabled = shouldBeEnabled; }
+
+    // Call at the start of each block. Returns false when the block should
+    // not be rendered at all.
+    bool beginBlock (bool hostIsPlaying) noexcept;
+
+    // True once after a resume: the engines should be reset before rendering
+    bool consumeResetRequest() noexcept
+    {
+        return std::exchange (resetRequested, false);
+    }
+
+    bool isSuspended() const noexcept   { return state == State::suspended; }
+
+    // Fade out before suspending / fade in after resuming
+    template <typename SampleType>
+    void applyGain (juce::AudioBuffer<SampleType>& buffer)
+    {
+        if (state == State::running && gain >= 1.0f)
+            return;
+
+        const int numSamples = buffer.getNumSamples();
+        const float step = (float) numSamples / (float) fadeSamples;
+
+        const float startGain = gain;
+        gain = juce::jlimit (0.0f, 1.0f, gain + (state == State::fadingOut ? -step : step));
+
+        buffer.applyGainRamp (0, numSamples, (SampleType) startGain, (SampleType) gain);
+
+        if (state == State::fadingOut && gain <= 0.0f)
+            state = State::suspended;
+    }
+
+private:
+    enum class State { running, fadingOut, suspended };
+
+    State state = State::running;
+    bool enabled = false;
+    bool resetRequested = false;
+
+    float gain = 1.0f;
+    int fadeSamples = 882;
+};
@@ -0,0 +1,186 @@
+#include "AxisVoiceBank.h"
+
+void AxisVoiceBank::prepare (double sampleRate, int maxBlockSize)
+{
+    maxBlock = juce::jmax (1, maxBlockSize);
+    lanes.prepare (sampleRate, maxBlock);
+
+    reset();
+}
+
+void AxisVoiceBank::reset()
+{
+    lanes.reset();
+
+    voiceNote.fill (-1);
+    voiceAge.fill (0);
+    ageCounter = 0;
+}
+
+void AxisVoiceBank::setNumVoices (int newNumVoices)
+{
+    newNumVoices = juce::jlimit (1, maxVoices, newNumVoices);
+
+    // Release anything above the new limit
+    for (int v = newNumVoices; v < numVoices; ++v)
+        if (voiceNote[(size_t) v] >= 0)
+        {
+            lanes.setLaneGate (v, false, 0.0f);
+            voiceNote[(size_t) v] = -1;
+        }
+
+    numVoices = newNumVoices;
+}
+
+void AxisVoiceBank::setMacros (float rotation, float body, float load, float mass, float wear)
+{
+    for (int v = 0; v < maxVoices; ++v)
+        lanes.setLaneMacros (v, rotation, body, load, mass, wear);
+}
+
+//==============================================================================
+int AxisVoiceBank::findVoiceToUse() const
+{
+    // Prefer a fully silent voice, then the oldest released one, then steal the oldest
+    int released = -1, oldest = 0;
+
+    for (int v = 0; v < numVoices; ++v)
+    {
+        if (voiceNote[(size_t) v] < 0)
+        {
+            if (lanes.isLaneSilent (v))
+                return v;
+
+            if (released < 0 || voiceAge[(size_t) v] < voiceAge[(size_t) released])
+                released = v;
+        }
+
+        if (voiceAge[(size_t) v] < voiceAge[(size_t) oldest])
+            oldest = v;
+    }
+
+    return released >= 0 ? released : oldest;
+}
+
+void AxisVoiceBank::noteOn (int note, float velocity)
+{
+    const int v = findVoiceToUse();
+
+    // Only restart the oscillators / filters if the lane has died away;
+    // a stolen voice glides from where it was to avoid a click.
+    if (lanes.isLaneSilent (v))
+        lanes.resetLane (v);
+
+    voiceNote[(size_t) v] = note;
+    voiceAge[(size_t) v]  = ++ageCounter;
+
+    lanes.setLaneFrequency (v, (float) juce::MidiMessage::getMidiNoteInHertz (note));
+    lanes.setLaneGate (v, true, velocity);
+}
+
+void AxisVoiceBank::noteOff (int note)
+{
+    for (int v = 0; v < numVoices; ++v)
+        if (voiceNote[(size_t) v] == note)
+        {
+            lanes.setLaneGate (v, false, 0.0f);
+            voiceNote[(size_t) v] = -1;
+        }
+}
+
+void AxisVoiceBank::allNotesOff()
+{
+    for (int v = 0; v < maxVoices; ++v)
+    {
+        lanes.setLaneGate (v, false, 0.0f);
+        voiceNote[(size_t) v] = -1;
+    }
+}
+
+void AxisVoiceBank::handleMidiEvent (const juce::MidiMessage& message)
+{
+    if (message.isNoteOn())
+        noteOn (message.getNoteNumber(), message.getFloatVelocity());
+    else if (message.isNoteOff())
+        noteOff (message.getNoteNumber());
+    else if (message.isAllNotesOff() || message.isAllSoundOff())
+        allNotesOff();
+}
+
+//==============================================================================
+void AxisVoiceBank::render (float* left, float* right, int numSamples)
+{
+    // Only render up to the highest sounding lane, rounded to a vector width,
+    // so cost follows the number of active voices.
+    int highest = 0;
+
+    for (int v = 0; v < maxVoices; ++v)
+        if (! lanes.isLaneSilent (v))
+            highest = v + 1;
+
+    if (highest == 0)
+        return;
+
+    const int lanesToRender = juce::jmin (maxVoices, (highest + 3) & ~3);
+
+    // Keep the summed level close to the monophonic engine
+    const float voiceGain = 1.0f / std::sqrt ((float) numVoices);
+
+    for (int start = 0; start < numSamples; start += maxBlock)
+    {
+        const int num = juce::jmin (maxBlock, numSamples - start);
+        lanes.process (num, lanesToRender);
+
+        for (int i = 0; i < num; ++i)
+        {
+            const float* frameL = lanes.getFrame (0, i);
+            const float* frameR = lanes.getFrame (1, i);
+
+            float sumL = 0.0f, sumR = 0.0f;
+
+            for (int v = 0; v < lanesToRender; ++v)
+            {
+                sumL += frameL[v];
+                sumR += frameR[v];
+            }
+
+            left[start + i]  += sumL * voiceGain;
+            right[start + i] += sumR * voiceGain;
+        }
+    }
+}
+
+void AxisVoiceBank::process (juce::AudioBuffer<float>& buffer, const juce::MidiBuffer& midi)
+{
+    buffer.clear();
+
+    const int numSamples = buffer.getNumSamples();
+    const int numCh      = buffer.getNumChannels();
+
+    auto* left  = buffer.getWritePointer (0);
+    auto* right = buffer.getWritePointer (numCh > 1 ? 1 : 0);
+
+    // Mono bus: render into a single channel and avoid doubling up
+    float* renderRight = numCh > 1 ? right : left;
+
+    int position = 0;
+
+    for (const auto metadata : midi)
+    {
+        const int eventPos = juce::jlimit (position, numSamples, metadata.samplePosition);
+
+        if (eventPos > position)
+        {
+            render (left + position, renderRight + position, eventPos - position);
+            position = eventPos;
+        }
+
+        handleMidiEvent (metadata.getMessage());
+    }
+
+    if (position < numSamples)
+        render (left + position, renderRight + position, numSamples - position);
+
+    if (numCh == 1)
+        buffer.applyGain (0.5f);
+}
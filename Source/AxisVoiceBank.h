@@ -0,0 +1,37 @@
+#pragma once
+#include <JuceHeader.h>
+#include "AxisLaneEngine.h"
+
+// Polyphonic AXIS: MIDI notes are assigned to lanes of an AxisLaneEngine.
+// Allocation and stealing work on fixed arrays and never allocate.
+class AxisVoiceBank
+{
+public:
+    static constexpr int maxVoices = AxisLaneEngine::numLanes;
+
+    void prepare (double sampleRate, int maxBlockSize);
+    void reset();
+    void process (juce::AudioBuffer<float>& buffer, const juce::MidiBuffer& midi);
+
+    void setNumVoices (int newNumVoices);
+    void setMacros (float rotation, float body, float load, float mass, float wear);
+    void setControlInterval (int numSamples) noexcept   { lanes.setControlInterval (numSamples); }
+
+private:
+    void handleMidiEvent (const juce::MidiMessage& message);
+    void noteOn (int note, float velocity);
+    void noteOff (int note);
+    void allNotesOff();
+
+    int findVoiceToUse() const;
+    void render (float* left, float* right, int numSamples);
+
+    AxisLaneEngine lanes;
+
+    int maxBlock = 512;
+    int numVoices = 8;
+
+    std::array<int, maxVoices> voiceNote {};       // -1 = free
+    std::array<uint32_t, maxVoices> voiceAge {};
+    uint32_t ageCounter = 0;
+};
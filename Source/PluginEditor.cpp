@@ -11,9 +11,15 @@
 
 //==============================================================================
 AXISAudioProcessorEditor::AXISAudioProcessorEditor (AXISAudioProcessor& p)
-    : AudioProcessorEditor (&p), processor (p)
+    : AudioProcessorEditor (&p), processor (p), rotationView (p.getTelemetry(), [&p] { return p.takeOutputReduction(); }),
+      spectrumView (p.getAnalyser()),
+      morphPad (p)
 {
-    background = juce::ImageCache::getFromMemory (BinaryData::AXIS_BG_png, BinaryData::AXIS_BG_pngSize);
+    background->addChangeListener (this);
+
+    // The background (or its placeholder) covers every pixel, so knob
+    // repaints only redraw their own dirty region
+    setOpaque (true);
     setSize (baseW, baseH);
     
     auto setupKnob = [] (juce::Slider& s)
@@ -44,20 +50,78 @@ AXISAudioProcessorEditor::AXISAudioProcessorEditor (AXISAudioProcessor& p)
     attBody     = std::make_unique<Attachment> (processor.apvts, "BODY",     body);
     attLoad     = std::make_unique<Attachment> (processor.apvts, "LOAD",     load);
     attWear     = std::make_unique<Attachment> (processor.apvts, "WEAR",     wear);
+
+    statusLabel.setJustificationType (juce::Justification::centredRight);
+    statusLabel.setColour (juce::Label::textColourId, juce::Colours::white.withAlpha (0.6f));
+    statusLabel.setInterceptsMouseClicks (false, false);
+    addAndMakeVisible (statusLabel);
+    addAndMakeVisible (rotationView);
+    addAndMakeVisible (spectrumView);
+    addAndMakeVisible (morphPad);
+
+   #if AXIS_USE_OPENGL
+    openGLContext.attachTo (*this);
+   #endif
+
+    startTimerHz (10);
+}
+
+AXISAudioProcessorEditor::~AXISAudioProcessorEditor()
+{
+    background->removeChangeListener (this);
+
+   #if AXIS_USE_OPENGL
+    openGLContext.detach();
+   #endif
+}
+
+void AXISAudioProcessorEditor::timerCallback()
+{
+    const int loadPercent = juce::roundToInt (processor.getCpuLoad() * 100.0f);
+    const float modPercent = processor.getModulationLoad() * 100.0f;
+
+    statusLabel.setText ("Q" + juce::String (processor.getQualityTier())
+                           + "  " + juce::String (loadPercent) + "%"
+                           + "  mod " + juce::String (modPercent, 2) + "%",
+                         juce::dontSendNotification);
 }
 
 
 //==============================================================================
+void AXISAudioProcessorEditor::changeListenerCallback (juce::ChangeBroadcaster*)
+{
+    // Background finished decoding
+    scaledBackground = {};
+    repaint();
+}
+
 void AXISAudioProcessorEditor::paint (juce::Graphics& g)
 {
-    g.fillAll (juce::Colours::black);
+    // Rescale the PNG only when the size or display scale changed; every
+    // other repaint is a 1:1 blit of the clipped region
+    const float scale = g.getInternalContext().getPhysicalPixelScaleFactor();
+
+    if (scaledBackground.isNull() || scale != scaledBackgroundScale)
+    {
+        scaledBackground = background->getScaled (juce::roundToInt (getWidth()  * scale),
+                                                  juce::roundToInt (getHeight() * scale));
+        scaledBackgroundScale = scale;
+    }
+
+    if (scaledBackground.isNull())
+    {
+        // Placeholder while the shared background is still decoding
+        g.fillAll (juce::Colours::black);
+        return;
+    }
 
-    // Draw background scaled to editor size
-    g.drawImage (background, getLocalBounds().toFloat());
+    g.drawImageTransformed (scaledBackground, juce::AffineTransform::scale (1.0f / scale));
 }
 
 void AXISAudioProcessorEditor::resized()
 {
+    scaledBackground = {};
+
     const float sx = getWidth()  / (float) baseW;
     const float sy = getHeight() / (float) baseH;
 
@@ -76,4 +140,9 @@ void AXISAudioProcessorEditor::resized()
     body.setBounds     (S (300, 125,  50,  50));
     load.setBounds     (S ( 50, 450,  50,  50));
     wear.setBounds     (S (300, 450,  50,  50));
+
+    statusLabel.setBounds (S (200, 575, 190, 20));
+    rotationView.setBounds (S (110, 400, 180, 40));
+    spectrumView.setBounds (S (110, 450, 180, 50));
+    morphPad.setBounds     (S (150,  40, 100, 70));
 }
@@ -10,34 +10,73 @@
 
 #include <JuceHeader.h>
 #include "PluginProcessor.h"
+#include "AxisBackground.h"
+#include "AxisRotationView.h"
+#include "AxisSpectrumView.h"
+#include "AxisMorphPad.h"
+
+// GPU-backed editor rendering where the OpenGL module is available
+// (OpenGL is deprecated on macOS, so CoreGraphics is kept there)
+#ifndef AXIS_USE_OPENGL
+ #if JUCE_MODULE_AVAILABLE_juce_opengl && ! JUCE_MAC
+  #define AXIS_USE_OPENGL 1
+ #else
+  #define AXIS_USE_OPENGL 0
+ #endif
+#endif
 
 //==============================================================================
 /**
 */
-class AXISAudioProcessorEditor  : public juce::AudioProcessorEditor
+class AXISAudioProcessorEditor  : public juce::AudioProcessorEditor,
+                                   private juce::Timer,
+                                   private juce::ChangeListener
 {
 public:
     AXISAudioProcessorEditor (AXISAudioProcessor&);
-    ~AXISAudioProcessorEditor() override = default;
+    ~AXISAudioProcessorEditor() override;
 
     //==============================================================================
     void paint (juce::Graphics&) override;
     void resized() override;
 
 private:
+    void timerCallback() override;
+    void changeListenerCallback (juce::ChangeBroadcaster*) override;
 
     AXISAudioProcessor& processor;
-    juce::Image background;
+
+    // Decoded off the message thread and shared by every open editor
+    juce::SharedResourcePointer<AxisBackground> background;
+
+    // This editor's handle on the shared variant for its size / display
+    // scale; cleared in resized() and fetched lazily on the next paint
+    juce::Image scaledBackground;
+    float scaledBackgroundScale = 0.0f;
 
     juce::Slider rotation, mass, body, load, wear;
     
     using Attachment = juce::AudioProcessorValueTreeState::SliderAttachment;
     std::unique_ptr<Attachment> attRotation, attMass, attBody, attLoad, attWear;
+
+    // Quality governor readout (tier + processBlock load)
+    juce::Label statusLabel;
+
+    // Live engine state (filter centres, rotation phase, level)
+    AxisRotationView rotationView;
+
+    // Output spectrum + scope (analysis runs only while this exists)
+    AxisSpectrumView spectrumView;
+
+    // MORPH_X / MORPH_Y pad (shift-click a corner to store a snapshot)
+    AxisMorphPad morphPad;
     
     static constexpr int baseW = 400;
     static constexpr int baseH = 600;
-    
-    
+
+   #if AXIS_USE_OPENGL
+    juce::OpenGLContext openGLContext;
+   #endif
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (AXISAudioProcessorEditor)
 };
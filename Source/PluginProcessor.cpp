@@ -23,10 +23,40 @@ AXISAudioProcessor::AXISAudioProcessor()
     , apvts (*this, nullptr, "PARAMETERS", createParameterLayout())
 #endif
 {
+    parameterSnapshot.resize ((size_t) getParameters().size(), -1.0f);
+
+    // Only the live engines publish (see finishEngineFade)
+    engines[0].setTelemetry (&telemetry);
+    enginesDouble[0].setTelemetry (&telemetry);
+
+    for (size_t slot = 0; slot < AxisModMatrix::numSlots; ++slot)
+    {
+        const juce::String n ((int) slot + 1);
+
+        modSourceParameters[slot] = apvts.getRawParameterValue ("MODSRC" + n);
+        modTargetParameters[slot] = apvts.getRawParameterValue ("MODDST" + n);
+        modDepthParameters[slot]  = apvts.getRawParameterValue ("MODAMT" + n);
+    }
+
+    for (size_t m = 0; m < AxisPreset::numMacros; ++m)
+    {
+        macroParameters[m] = apvts.getRawParameterValue (AxisPreset::macroIDs[m]);
+        baseMacros[m] = macros[m] = macroParameters[m]->load();
+    }
+
+    // Morph corners start out as the first factory presets
+    for (size_t corner = 0; corner < numMorphSnapshots; ++corner)
+    {
+        const auto& preset = presets.getTable()[corner];
+
+        for (size_t m = 0; m < AxisPreset::numMacros; ++m)
+            morphSnapshots[corner][m].store (preset.macros[m]);
+    }
 }
 
 AXISAudioProcessor::~AXISAudioProcessor()
 {
+    cancelPendingUpdate();
 }
 
 //==============================================================================
@@ -69,22 +99,35 @@ double AXISAudioProcessor::getTailLengthSeconds() const
 
 int AXISAudioProcessor::getNumPrograms()
 {
-    return 1;   // NB: some hosts don't cope very well if you tell them there are 0 programs,
-                // so this should be at least 1, even if you're not really implementing programs.
+    return (int) presets.getTable().size();   // the factory bank is never empty
 }
 
 int AXISAudioProcessor::getCurrentProgram()
 {
-    return 0;
+    return currentProgram.load();
 }
 
 void AXISAudioProcessor::setCurrentProgram (int index)
 {
+    // May be called on any thread, including the audio thread: atomics only
+    if (! juce::isPositiveAndBelow (index, getNumPrograms()))
+        return;
+
+    currentProgram.store (index);
+    ++programSerial;
+    pendingProgram.store (index);
+
+    triggerAsyncUpdate();
 }
 
 const juce::String AXISAudioProcessor::getProgramName (int index)
 {
-    return {};
+    const auto& table = presets.getTable();
+
+    if (! juce::isPositiveAndBelow (index, (int) table.size()))
+        return {};
+
+    return table[(size_t) index].name;
 }
 
 void AXISAudioProcessor::changeProgramName (int index, const juce::String& newName)
@@ -102,6 +145,76 @@ juce::AudioProcessorValueTreeState::ParameterLayout AXISAudioProcessor::createPa
     params.push_back (std::make_unique<juce::AudioParameterFloat> ("LOAD", "Load", juce::NormalisableRange<float> (0.0f, 1.0f, 0.0f, 0.5f), 0.4f));
     params.push_back (std::make_unique<juce::AudioParameterFloat> ("WEAR", "Wear", juce::NormalisableRange<float> (0.0f, 1.0f, 0.0f, 0.5f), 0.2f));
 
+    // Polyphony: MIDI notes drive up to 16 voices instead of the fixed drone
+    params.push_back (std::make_unique<juce::AudioParameterBool> ("POLY", "Poly", false));
+    params.push_back (std::make_unique<juce::AudioParameterInt> ("VOICES", "Voices", 1, AxisVoiceBank::maxVoices, 8));
+
+    // Run the drone engine at ~48 kHz and up-sample at higher host rates
+    params.push_back (std::make_unique<juce::AudioParameterBool> ("FIXEDRATE", "Fixed Rate Core", false));
+
+    // Number of rotating bandpass filters around the spectral axis
+    params.push_back (std::make_unique<juce::AudioParameterChoice> ("FILTERS", "Filters", juce::StringArray { "2", "4", "8", "16" }, 0));
+
+    // Independent L / R filter lanes, oscillators and drift (stereo outputs)
+    params.push_back (std::make_unique<juce::AudioParameterBool> ("DECORR", "Decorrelated Stereo", false));
+
+    // Engine mode: rotating filter bank, or STFT rotation of the spectrum
+    params.push_back (std::make_unique<juce::AudioParameterChoice> ("MODE", "Mode", juce::StringArray { "Filters", "Spectral" }, 0));
+    params.push_back (std::make_unique<juce::AudioParameterChoice> ("SPECSIZE", "Spectral Frame", juce::StringArray { "512", "1024", "2048" }, 1));
+    params.push_back (std::make_unique<juce::AudioParameterChoice> ("SPECOVERLAP", "Spectral Overlap", juce::StringArray { "2x", "4x", "8x" }, 1));
+
+    // Modal body resonator bank
+    params.push_back (std::make_unique<juce::AudioParameterChoice> ("MODES", "Body Modes", juce::StringArray { "Off", "32", "64", "128", "256" }, 0));
+    params.push_back (std::make_unique<juce::AudioParameterFloat> ("MODALMIX", "Body Mix", juce::NormalisableRange<float> (0.0f, 1.0f), 0.5f));
+
+    // Convolution with procedurally generated chassis responses, morphed by BODY
+    params.push_back (std::make_unique<juce::AudioParameterFloat> ("CHASSIS", "Chassis", juce::NormalisableRange<float> (0.0f, 1.0f), 0.0f));
+
+    // Eco freeze: loop a recorded window while no parameter moves
+    params.push_back (std::make_unique<juce::AudioParameterBool> ("ECO", "Eco Freeze", false));
+    params.push_back (std::make_unique<juce::AudioParameterFloat> ("ECOWINDOW", "Eco Window", juce::NormalisableRange<float> (1.0f, (float) AxisLoopCache::maxWindowSeconds, 0.1f), 6.0f));
+
+    // Tempo-synced rotation, locked to the play head position
+    params.push_back (std::make_unique<juce::AudioParameterBool> ("SYNC", "Tempo Sync", false));
+    params.push_back (std::make_unique<juce::AudioParameterChoice> ("RATEDIV", "Rotation Length",
+                                                                    juce::StringArray { "1 Bar", "2 Bars", "4 Bars", "8 Bars", "16 Bars", "32 Bars", "64 Bars" }, 3));
+
+    // Stop rendering (after a fade) while the host transport is stopped
+    params.push_back (std::make_unique<juce::AudioParameterBool> ("TRANSPORT", "Suspend When Stopped", false));
+
+    // XY morph of the macros between stored snapshots (see storeMorphSnapshot)
+    params.push_back (std::make_unique<juce::AudioParameterChoice> ("MORPH", "Morph", juce::StringArray { "Off", "A-B", "A-B-C-D" }, 0));
+    params.push_back (std::make_unique<juce::AudioParameterFloat> ("MORPH_X", "Morph X", juce::NormalisableRange<float> (0.0f, 1.0f), 0.0f));
+    params.push_back (std::make_unique<juce::AudioParameterFloat> ("MORPH_Y", "Morph Y", juce::NormalisableRange<float> (0.0f, 1.0f), 0.0f));
+
+    // Modulation matrix: four routes from the control-rate sources
+    for (int slot = 1; slot <= AxisModMatrix::numSlots; ++slot)
+    {
+        const juce::String n (slot);
+
+        params.push_back (std::make_unique<juce::AudioParameterChoice> ("MODSRC" + n, "Mod " + n + " Source",
+                                                                        juce::StringArray { "None", "LFO 1", "LFO 2", "Random", "Input Env" }, 0));
+        params.push_back (std::make_unique<juce::AudioParameterChoice> ("MODDST" + n, "Mod " + n + " Target",
+                                                                        juce::StringArray { "Rotation", "Mass", "Body", "Load", "Wear", "Centre", "Sweep", "Width" }, 0));
+        params.push_back (std::make_unique<juce::AudioParameterFloat> ("MODAMT" + n, "Mod " + n + " Depth", juce::NormalisableRange<float> (-1.0f, 1.0f), 0.0f));
+    }
+
+    params.push_back (std::make_unique<juce::AudioParameterFloat> ("LFO1RATE", "LFO 1 Rate", juce::NormalisableRange<float> (0.01f, AxisModMatrix::maxRateHz, 0.0f, 0.3f), 0.2f));
+    params.push_back (std::make_unique<juce::AudioParameterFloat> ("LFO2RATE", "LFO 2 Rate", juce::NormalisableRange<float> (0.01f, AxisModMatrix::maxRateHz, 0.0f, 0.3f), 0.07f));
+    params.push_back (std::make_unique<juce::AudioParameterFloat> ("RANDRATE", "Random Rate", juce::NormalisableRange<float> (0.01f, AxisModMatrix::maxRateHz, 0.0f, 0.3f), 0.5f));
+
+    // DC blocker + zero-latency peak limiter on the plugin output
+    params.push_back (std::make_unique<juce::AudioParameterBool> ("SAFETY", "Output Safety", false));
+
+    // Oversampling of the waveshaping stages only
+    params.push_back (std::make_unique<juce::AudioParameterChoice> ("OVERSAMPLE", "Oversampling", juce::StringArray { "1x", "2x", "4x" }, 0));
+
+    // Antiderivative anti-aliasing of the same stages (cheaper than oversampling)
+    params.push_back (std::make_unique<juce::AudioParameterChoice> ("ADAA", "Antialiasing", juce::StringArray { "Off", "1st Order", "2nd Order" }, 0));
+
+    // Step quality down automatically when processBlock nears its deadline
+    params.push_back (std::make_unique<juce::AudioParameterBool> ("GOVERNOR", "Quality Governor", false));
+
     return { params.begin(), params.end() };
 }
 
@@ -109,7 +222,492 @@ juce::AudioProcessorValueTreeState::ParameterLayout AXISAudioProcessor::createPa
 //==============================================================================
 void AXISAudioProcessor::prepareToPlay (double sampleRate, int samplesPerBlock)
 {
-   engine.prepare (sampleRate);
+   hostSampleRate = sampleRate;
+   hostBlockSize  = samplesPerBlock;
+
+   internalRate.prepare (sampleRate, samplesPerBlock, getTotalNumOutputChannels());
+   voiceBank.prepare (sampleRate, samplesPerBlock);
+   governor.prepare (sampleRate);
+
+   chassis.setBody (apvts.getRawParameterValue ("BODY")->load());
+   chassis.prepare (sampleRate, samplesPerBlock, juce::jmin (2, getTotalNumOutputChannels()));
+   loopCache.prepare (sampleRate, samplesPerBlock, getTotalNumOutputChannels());
+   transportGate.prepare (sampleRate);
+   outputStage.prepare (sampleRate);
+   outputStageDouble.prepare (sampleRate);
+   modMatrix.prepare (sampleRate);
+
+   glideSamples   = juce::jmax (1, juce::roundToInt (presetGlideSeconds * sampleRate));
+   glideRemaining = 0;
+   updateMacros (0);
+   analyser.prepare (sampleRate);
+
+   floatScratch.setSize (getTotalNumOutputChannels(), samplesPerBlock);
+
+   // Any switch in flight is dropped: every engine is prepared here
+   switchState.store (switchIdle);
+   engineFadeSamples   = juce::jmax (1, juce::roundToInt (engineFadeSeconds * sampleRate));
+   engineFadeRemaining = 0;
+
+   fadeScratch.setSize (getTotalNumOutputChannels(), samplesPerBlock);
+   fadeScratchDouble.setSize (getTotalNumOutputChannels(), samplesPerBlock);
+
+   liveConfig = standbyConfig = getWantedConfig();
+   preparedForInternalRate.fill (liveConfig.internalRate);
+
+   const double engineRate = liveConfig.internalRate ? internalRate.getInternalRate() : sampleRate;
+   const auto outputLayout = getChannelLayoutOfBus (false, 0);
+   ambisonicOutput = outputLayout.getAmbisonicOrder() >= 0;
+
+   forEachEngine ([&] (auto& eng)
+   {
+       eng.setOutputLayout (outputLayout);
+       eng.prepare (engineRate, samplesPerBlock);
+       applyEngineConfig (eng, liveConfig);
+   });
+
+   internalRate.reset();
+
+   setLatencySamples (getEngineLatency());
+}
+
+AXISAudioProcessor::EngineConfig AXISAudioProcessor::getWantedConfig() const
+{
+    EngineConfig config;
+    config.internalRate    = wantsInternalRate();
+    config.mode            = (int) apvts.getRawParameterValue ("MODE")->load();
+    config.spectralSize    = (int) apvts.getRawParameterValue ("SPECSIZE")->load();
+    config.spectralOverlap = (int) apvts.getRawParameterValue ("SPECOVERLAP")->load();
+    config.numFilters      = 2 << (int) apvts.getRawParameterValue ("FILTERS")->load();
+    config.oversampling    = (int) apvts.getRawParameterValue ("OVERSAMPLE")->load();
+    config.tier            = governor.getActiveTier();
+
+    const int modesIndex = (int) apvts.getRawParameterValue ("MODES")->load();
+    config.modalModes = modesIndex == 0 ? 0 : 16 << modesIndex;
+
+    return config;
+}
+
+template <typename SampleType>
+void AXISAudioProcessor::applyEngineConfig (AxisEngine<SampleType>& eng, const EngineConfig& config)
+{
+    eng.setSpectralResolution (config.spectralSize, config.spectralOverlap);
+    eng.setMode (config.mode);
+    eng.setNumFilters (config.numFilters);
+    eng.setModalModes (config.modalModes);
+    eng.setOversampling (config.oversampling);
+    eng.setControlInterval (config.tier >= AxisQualityGovernor::controlRate ? 16 : 1);
+    eng.setFastShapers (config.tier >= AxisQualityGovernor::approxShapers);
+}
+
+bool AXISAudioProcessor::wantsInternalRate() const
+{
+    return apvts.getRawParameterValue ("FIXEDRATE")->load() >= 0.5f
+        && internalRate.isActive()
+        && apvts.getRawParameterValue ("POLY")->load() < 0.5f;
+}
+
+void AXISAudioProcessor::updateEngineSwitch()
+{
+    const int state = switchState.load (std::memory_order_acquire);
+
+    if (state == switchPreparing || state == switchFading)
+        return;
+
+    const auto wanted = getWantedConfig();
+
+    if (wanted == liveConfig)
+    {
+        // Changed back while the standby was being prepared: nothing to do
+        if (state == switchReady)
+            switchState.store (switchIdle);
+
+        return;
+    }
+
+    standbyConfig = wanted;
+
+    if (preparedForInternalRate[(size_t) getStandbyEngine()] == standbyConfig.internalRate)
+    {
+        beginEngineFade();
+        return;
+    }
+
+    // Re-preparing allocates: hand the standby to the message thread
+    switchState.store (switchPreparing, std::memory_order_release);
+    triggerAsyncUpdate();
+}
+
+void AXISAudioProcessor::prepareStandbyEngines()
+{
+    // The audio thread doesn't touch the standby pair, liveEngine or
+    // standbyConfig until this hands them back
+    const int slot = getStandbyEngine();
+    const double engineRate = standbyConfig.internalRate ? internalRate.getInternalRate() : hostSampleRate;
+
+    engines[(size_t) slot].prepare (engineRate, hostBlockSize);
+    enginesDouble[(size_t) slot].prepare (engineRate, hostBlockSize);
+    preparedForInternalRate[(size_t) slot] = standbyConfig.internalRate;
+
+    switchState.store (switchReady, std::memory_order_release);
+}
+
+void AXISAudioProcessor::beginEngineFade()
+{
+    const int live = liveEngine, standby = getStandbyEngine();
+
+    applyEngineConfig (engines[(size_t) standby], standbyConfig);
+    applyEngineConfig (enginesDouble[(size_t) standby], standbyConfig);
+
+    withRenderingEngine (live, liveConfig.internalRate, [&] (auto& outgoing)
+    {
+        withRenderingEngine (standby, standbyConfig.internalRate, [&] (auto& incoming)
+        {
+            incoming.reset();
+            incoming.continueFrom (outgoing);
+        });
+    });
+
+    if (standbyConfig.internalRate)
+        internalRate.reset();
+
+    engineFadeRemaining = engineFadeSamples;
+    switchState.store (switchFading);
+}
+
+void AXISAudioProcessor::finishEngineFade()
+{
+    engines[(size_t) liveEngine].setTelemetry (nullptr);
+    enginesDouble[(size_t) liveEngine].setTelemetry (nullptr);
+
+    liveEngine = getStandbyEngine();
+    liveConfig = standbyConfig;
+
+    engines[(size_t) liveEngine].setTelemetry (&telemetry);
+    enginesDouble[(size_t) liveEngine].setTelemetry (&telemetry);
+
+    switchState.store (switchIdle);
+    updateLatency();
+}
+
+template <typename SampleType>
+void AXISAudioProcessor::crossfadeEngines (juce::AudioBuffer<SampleType>& buffer, const juce::AudioBuffer<SampleType>& incoming)
+{
+    const int numSamples = buffer.getNumSamples();
+    const int numCh      = juce::jmin (buffer.getNumChannels(), incoming.getNumChannels());
+    const int num        = juce::jmin (numSamples, engineFadeRemaining);
+
+    const auto from = (SampleType) engineFadeRemaining / (SampleType) engineFadeSamples;
+    const auto to   = (SampleType) (engineFadeRemaining - num) / (SampleType) engineFadeSamples;
+
+    // Linear: both engines render the same sound, so the outputs are correlated
+    for (int ch = 0; ch < numCh; ++ch)
+    {
+        buffer.applyGainRamp (ch, 0, num, from, to);
+        buffer.addFromWithRamp (ch, 0, incoming.getReadPointer (ch), num, (SampleType) 1 - from, (SampleType) 1 - to);
+
+        if (num < numSamples)
+            buffer.copyFrom (ch, num, incoming, ch, num, numSamples - num);
+    }
+
+    engineFadeRemaining -= num;
+
+    if (engineFadeRemaining <= 0)
+        finishEngineFade();
+}
+
+void AXISAudioProcessor::applyQualityTier()
+{
+    // The lanes already run at control rate with rational shapers, so the
+    // poly path steps down by updating its cutoffs less often
+    const int tier = governor.getActiveTier();
+
+    voiceBank.setControlInterval (tier >= AxisQualityGovernor::controlRate ? 4 * AxisLaneEngine::defaultControlInterval
+                                                                            : AxisLaneEngine::defaultControlInterval);
+}
+
+void AXISAudioProcessor::readHostPosition()
+{
+    // No play head (or no position) counts as playing: never suspend blindly
+    hostPlaying = true;
+    hostHasPosition = false;
+
+    if (auto* playHead = getPlayHead())
+    {
+        if (auto position = playHead->getPosition())
+        {
+            hostPlaying = position->getIsPlaying();
+
+            const auto ppq = position->getPpqPosition();
+            const auto bpm = position->getBpm();
+
+            if (hostPlaying && ppq.hasValue() && bpm.hasValue())
+            {
+                hostPpq = *ppq;
+                hostBpm = *bpm;
+                hostHasPosition = true;
+            }
+        }
+    }
+}
+
+double AXISAudioProcessor::getBeatsPerCycle (int divisionIndex)
+{
+    // 1 .. 64 bars of 4/4
+    return 4.0 * (double) (1 << juce::jlimit (0, 6, divisionIndex));
+}
+
+template <typename SampleType>
+void AXISAudioProcessor::syncEngineToHost (AxisEngine<SampleType>& eng, int hostOffset)
+{
+    const bool sync = apvts.getRawParameterValue ("SYNC")->load() >= 0.5f;
+    eng.setTempoSync (sync, getBeatsPerCycle ((int) apvts.getRawParameterValue ("RATEDIV")->load()));
+
+    // Stopped transport: keep rotating freely at the synced rate
+    if (sync && hostHasPosition)
+        eng.setTransportPosition (hostPpq + (double) hostOffset * hostBpm / (60.0 * hostSampleRate), hostBpm);
+}
+
+void AXISAudioProcessor::resetForPlayback()
+{
+    // A reset settles the rotation at the engine's current macro: hand over
+    // this block's macros first, not the ones from before the transport stopped
+    const auto rot  = getMacro (AxisPreset::rotation);
+    const auto body = getMacro (AxisPreset::body);
+    const auto load = getMacro (AxisPreset::load);
+    const auto mass = getMacro (AxisPreset::mass);
+    const auto wear = getMacro (AxisPreset::wear);
+
+    forEachEngine ([&] (auto& e)
+    {
+        e.setRotation (rot);
+        e.setBody (body);
+        e.setLoad (load);
+        e.setMass (mass);
+        e.setWear (wear);
+        e.reset();
+    });
+
+    voiceBank.setMacros (rot, body, load, mass, wear);
+    voiceBank.reset();
+    internalRate.reset();
+    chassis.reset();
+    loopCache.reset();
+    outputStage.reset();
+    outputStageDouble.reset();
+}
+
+void AXISAudioProcessor::handleAsyncUpdate()
+{
+    if (switchState.load (std::memory_order_acquire) == switchPreparing)
+        prepareStandbyEngines();
+
+    const int latency = pendingLatency.exchange (-1);
+
+    if (latency >= 0)
+        setLatencySamples (latency);
+
+    applyProgramToParameters();
+}
+
+void AXISAudioProcessor::applyProgramToParameters()
+{
+    // Read the serial first: a program change racing with this call bumps it
+    // again and schedules another update with the newer index
+    const auto serial = programSerial.load();
+    const int index   = currentProgram.load();
+
+    if (serial == appliedSerial.load())
+        return;
+
+    const auto& table = presets.getTable();
+
+    if (juce::isPositiveAndBelow (index, (int) table.size()))
+    {
+        const auto& preset = table[(size_t) index];
+
+        // The host asked for the program, so this isn't a user gesture
+        auto apply = [this] (const juce::String& id, float plainValue)
+        {
+            if (auto* param = apvts.getParameter (id))
+                param->setValueNotifyingHost (param->convertTo0to1 (plainValue));
+        };
+
+        for (size_t m = 0; m < AxisPreset::numMacros; ++m)
+            apply (AxisPreset::macroIDs[m], preset.macros[m]);
+
+        for (const auto& [id, value] : preset.settings)
+            apply (id, value);
+    }
+
+    appliedSerial.store (serial);
+}
+
+void AXISAudioProcessor::beginPresetRecall()
+{
+    const int index = pendingProgram.exchange (-1);
+
+    if (index < 0)
+        return;
+
+    const auto& table = presets.getTable();
+
+    if (! juce::isPositiveAndBelow (index, (int) table.size()))
+        return;
+
+    presetMacros   = table[(size_t) index].macros;
+    presetOverride = true;
+    overrideSerial = programSerial.load();
+
+    glideStart     = baseMacros;
+    glideRemaining = glideSamples;
+}
+
+void AXISAudioProcessor::storeMorphSnapshot (int index)
+{
+    if (! juce::isPositiveAndBelow (index, numMorphSnapshots))
+        return;
+
+    for (size_t m = 0; m < AxisPreset::numMacros; ++m)
+        morphSnapshots[(size_t) index][m].store (macroParameters[m]->load());
+}
+
+std::array<float, AxisPreset::numMacros> AXISAudioProcessor::getMorphMacros() const noexcept
+{
+    const int morphMode = (int) apvts.getRawParameterValue ("MORPH")->load();
+    const float x = apvts.getRawParameterValue ("MORPH_X")->load();
+    const float y = morphMode == 2 ? apvts.getRawParameterValue ("MORPH_Y")->load() : 0.0f;
+
+    std::array<float, AxisPreset::numMacros> result;
+
+    // Bilinear across the four corners; A-B mode stays on the top edge
+    for (size_t m = 0; m < AxisPreset::numMacros; ++m)
+    {
+        const float a = morphSnapshots[0][m].load (std::memory_order_relaxed);
+        const float b = morphSnapshots[1][m].load (std::memory_order_relaxed);
+        const float c = morphSnapshots[2][m].load (std::memory_order_relaxed);
+        const float d = morphSnapshots[3][m].load (std::memory_order_relaxed);
+
+        const float top    = a + (b - a) * x;
+        const float bottom = c + (d - c) * x;
+
+        result[m] = top + (bottom - top) * y;
+    }
+
+    return result;
+}
+
+void AXISAudioProcessor::updateMacros (int numSamples)
+{
+    // Hand back to the parameters once they hold this preset (or a newer one)
+    if (presetOverride && (juce::int32) (appliedSerial.load() - overrideSerial) >= 0)
+        presetOverride = false;
+
+    std::array<float, AxisPreset::numMacros> target;
+
+    // While morphing the macro knobs are ignored. The morph values move once
+    // per block: the engine and the voices ramp the LOAD / WEAR drive gains
+    // across each block, cutoffs follow through MASS inertia and rotation
+    // through its torque; the remaining mappings step at block rate.
+    if (apvts.getRawParameterValue ("MORPH")->load() >= 0.5f)
+    {
+        target = getMorphMacros();
+    }
+    else
+    {
+        for (size_t m = 0; m < AxisPreset::numMacros; ++m)
+            target[m] = presetOverride ? presetMacros[m] : macroParameters[m]->load();
+    }
+
+    if (glideRemaining <= 0)
+    {
+        baseMacros = target;
+    }
+    else
+    {
+        // Linear per-block glide, smoothed within blocks as the morph above is
+        glideRemaining = juce::jmax (0, glideRemaining - numSamples);
+        const float progress = 1.0f - (float) glideRemaining / (float) glideSamples;
+
+        for (size_t m = 0; m < AxisPreset::numMacros; ++m)
+            baseMacros[m] = glideStart[m] + (target[m] - glideStart[m]) * progress;
+    }
+
+    // Modulation matrix offsets on top (targets share the macro order)
+    for (size_t m = 0; m < AxisPreset::numMacros; ++m)
+        macros[m] = juce::jlimit (0.0f, 1.0f, baseMacros[m] + modMatrix.getOffset ((AxisModMatrix::Target) m));
+}
+
+template <typename SampleType>
+void AXISAudioProcessor::updateModulation (const juce::AudioBuffer<SampleType>& buffer)
+{
+    const auto startTicks = juce::Time::getHighResolutionTicks();
+    const int numSamples  = buffer.getNumSamples();
+
+    for (size_t slot = 0; slot < AxisModMatrix::numSlots; ++slot)
+        modMatrix.setRoute ((int) slot,
+                            (int) modSourceParameters[slot]->load(),
+                            (int) modTargetParameters[slot]->load(),
+                            modDepthParameters[slot]->load());
+
+    modMatrix.setRates (apvts.getRawParameterValue ("LFO1RATE")->load(),
+                        apvts.getRawParameterValue ("LFO2RATE")->load(),
+                        apvts.getRawParameterValue ("RANDRATE")->load());
+
+    modMatrix.analyseInput (buffer);
+    modMatrix.process (numSamples);
+
+    // Centre by up to +-2 octaves, sweep depth by up to +-100 %
+    const float centre = modMatrix.getOffset (AxisModMatrix::centreTarget) * 2.0f;
+    const float sweep  = modMatrix.getOffset (AxisModMatrix::sweepTarget);
+    const float width  = modMatrix.getOffset (AxisModMatrix::widthTarget);
+
+    forEachEngine ([=] (auto& eng) { eng.setInternalModulation (centre, sweep, width); });
+
+    if (numSamples > 0)
+    {
+        const double elapsed = juce::Time::highResolutionTicksToSeconds (juce::Time::getHighResolutionTicks() - startTicks);
+        modulationLoad.store ((float) (elapsed * hostSampleRate / numSamples));
+    }
+}
+
+bool AXISAudioProcessor::parametersMoved()
+{
+    bool moved = false;
+    size_t index = 0;
+
+    for (auto* param : getParameters())
+    {
+        const float value = param->getValue();
+
+        if (index < parameterSnapshot.size() && value != parameterSnapshot[index])
+        {
+            parameterSnapshot[index] = value;
+            moved = true;
+        }
+
+        ++index;
+    }
+
+    return moved;
+}
+
+int AXISAudioProcessor::getEngineLatency() const
+{
+    // Engine latency is in engine-rate samples (the spectral mode adds one STFT frame)
+    float latency = engines[(size_t) liveEngine].getLatencySamples();
+
+    if (liveConfig.internalRate)
+        latency = latency * (float) (hostSampleRate / internalRate.getInternalRate())
+                    + (float) internalRate.getLatencySamples();
+
+    return juce::roundToInt (latency);
+}
+
+void AXISAudioProcessor::updateLatency()
+{
+    pendingLatency.store (getEngineLatency());
+    triggerAsyncUpdate();
 }
 
 void AXISAudioProcessor::releaseResources()
@@ -125,12 +723,21 @@ bool AXISAudioProcessor::isBusesLayoutSupported (const BusesLayout& layouts) con
     juce::ignoreUnused (layouts);
     return true;
   #else
-    // This is the place where you check if the layout is supported.
-    // In this template code we only support mono or stereo.
-    // Some plugin hosts, such as certain GarageBand versions, will only
-    // load plugins that support stereo bus layouts.
-    if (layouts.getMainOutputChannelSet() != juce::AudioChannelSet::mono()
-     && layouts.getMainOutputChannelSet() != juce::AudioChannelSet::stereo())
+    // Mono, stereo, the common speaker layouts (the rotation runs around the
+    // speaker ring) and 1st to 3rd order ambisonics
+    const auto& out = layouts.getMainOutputChannelSet();
+
+    const bool supported = out == juce::AudioChannelSet::mono()
+                        || out == juce::AudioChannelSet::stereo()
+                        || out == juce::AudioChannelSet::quadraphonic()
+                        || out == juce::AudioChannelSet::create5point0()
+                        || out == juce::AudioChannelSet::create5point1()
+                        || out == juce::AudioChannelSet::create7point0()
+                        || out == juce::AudioChannelSet::create7point1()
+                        || out == juce::AudioChannelSet::create7point1point4()
+                        || juce::isPositiveAndNotGreaterThan (out.getAmbisonicOrder(), 3);
+
+    if (! supported)
         return false;
 
     // This checks if the input layout matches the output layout
@@ -145,23 +752,297 @@ bool AXISAudioProcessor::isBusesLayoutSupported (const BusesLayout& layouts) con
 #endif
 
 void AXISAudioProcessor::processBlock (juce::AudioBuffer<float>& buffer,
-                                      juce::MidiBuffer&)
+                                      juce::MidiBuffer& midiMessages)
+{
+    processBlockImpl (buffer, midiMessages);
+}
+
+void AXISAudioProcessor::processBlock (juce::AudioBuffer<double>& buffer,
+                                      juce::MidiBuffer& midiMessages)
+{
+    processBlockImpl (buffer, midiMessages);
+}
+
+template <typename SampleType>
+void AXISAudioProcessor::processBlockImpl (juce::AudioBuffer<SampleType>& buffer,
+                                          juce::MidiBuffer& midiMessages)
 {
     juce::ScopedNoDenormals noDenormals;
 
-    auto rot  = apvts.getRawParameterValue ("ROTATION")->load();
-    auto body = apvts.getRawParameterValue ("BODY")->load();
-    auto load = apvts.getRawParameterValue ("LOAD")->load();
-    auto mass = apvts.getRawParameterValue ("MASS")->load();
-    auto wear = apvts.getRawParameterValue ("WEAR")->load();
+    transportGate.setEnabled (apvts.getRawParameterValue ("TRANSPORT")->load() >= 0.5f);
+
+    readHostPosition();
+
+    if (! transportGate.beginBlock (hostPlaying))
+    {
+        buffer.clear();
+        return;
+    }
+
+    // On resume the modulation restarts before this block's macros are
+    // worked out; the engines are reset from those macros further down
+    const bool resuming = transportGate.consumeResetRequest();
+
+    if (resuming)
+        modMatrix.reset();
+
+    const auto startTicks = juce::Time::getHighResolutionTicks();
 
-    engine.setRotation (rot);
-    engine.setBody (body);
-    engine.setLoad (load);
-    engine.setMass (mass);
-    engine.setWear (wear);
+    governor.setEnabled (apvts.getRawParameterValue ("GOVERNOR")->load() >= 0.5f);
+    applyQualityTier();
+    updateEngineSwitch();
 
-    engine.process (buffer);
+    // Both engines render in this block (the fade may complete within it)
+    const bool switching = switchState.load() == switchFading;
+
+    loopCache.setEnabled (apvts.getRawParameterValue ("ECO")->load() >= 0.5f);
+    loopCache.setWindowSeconds (apvts.getRawParameterValue ("ECOWINDOW")->load());
+
+    updateModulation (buffer);
+
+    beginPresetRecall();
+    const bool recalling = presetOverride || glideRemaining > 0;
+    updateMacros (buffer.getNumSamples());
+
+    if (resuming)
+        resetForPlayback();
+
+    const bool moved = parametersMoved() || recalling || modMatrix.isActive() || ! midiMessages.isEmpty()
+                    || switchState.load() != switchIdle;
+
+    loopCache.process (buffer, moved, [&] (juce::AudioBuffer<SampleType>& block)
+    {
+        renderBlock (block, midiMessages);
+        applyChassis (block);
+    });
+
+    transportGate.applyGain (buffer);
+    applyOutputSafety (buffer);
+    analyser.push (buffer);
+    governor.endBlock (juce::Time::getHighResolutionTicks() - startTicks, buffer.getNumSamples(), switching);
+}
+
+template <typename SampleType>
+void AXISAudioProcessor::renderBlock (juce::AudioBuffer<SampleType>& buffer, juce::MidiBuffer& midiMessages)
+{
+    const bool poly = apvts.getRawParameterValue ("POLY")->load() >= 0.5f;
+
+    if constexpr (std::is_same_v<SampleType, double>)
+    {
+        if (poly)
+        {
+            renderThroughFloat (buffer, midiMessages);
+            return;
+        }
+    }
+    else
+    {
+        if (poly)
+        {
+            voiceBank.setNumVoices ((int) apvts.getRawParameterValue ("VOICES")->load());
+            voiceBank.setMacros (getMacro (AxisPreset::rotation), getMacro (AxisPreset::body),
+                                 getMacro (AxisPreset::load), getMacro (AxisPreset::mass), getMacro (AxisPreset::wear));
+            voiceBank.process (buffer, midiMessages);
+
+            // The engines aren't heard: a switch completes without a fade
+            if (switchState.load() == switchFading)
+                finishEngineFade();
+
+            return;
+        }
+    }
+
+    renderEngine (liveEngine, liveConfig.internalRate, buffer);
+
+    // Mid-switch: the standby renders too and fades in over the live output
+    if (switchState.load() == switchFading)
+    {
+        auto& scratch = [this]() -> juce::AudioBuffer<SampleType>&
+        {
+            if constexpr (std::is_same_v<SampleType, float>)
+                return fadeScratch;
+            else
+                return fadeScratchDouble;
+        }();
+
+        const int numSamples = buffer.getNumSamples();
+        const int numCh      = juce::jmin (buffer.getNumChannels(), scratch.getNumChannels());
+
+        // Only reallocates if the host exceeds the prepared block size
+        scratch.setSize (scratch.getNumChannels(), numSamples, false, false, true);
+
+        juce::AudioBuffer<SampleType> incoming (scratch.getArrayOfWritePointers(), numCh, numSamples);
+        renderEngine (getStandbyEngine(), standbyConfig.internalRate, incoming);
+
+        crossfadeEngines (buffer, incoming);
+    }
+}
+
+template <typename SampleType>
+void AXISAudioProcessor::configureEngine (AxisEngine<SampleType>& eng)
+{
+    eng.setRotation (getMacro (AxisPreset::rotation));
+    eng.setBody (getMacro (AxisPreset::body));
+    eng.setLoad (getMacro (AxisPreset::load));
+    eng.setMass (getMacro (AxisPreset::mass));
+    eng.setWear (getMacro (AxisPreset::wear));
+    eng.setStereoDecorrelation (apvts.getRawParameterValue ("DECORR")->load() >= 0.5f);
+    eng.setAntialiasing ((int) apvts.getRawParameterValue ("ADAA")->load());
+    eng.setModalMix (apvts.getRawParameterValue ("MODALMIX")->load());
+}
+
+template <typename SampleType>
+void AXISAudioProcessor::renderEngine (int slot, bool atInternalRate, juce::AudioBuffer<SampleType>& buffer)
+{
+    if (! atInternalRate)
+    {
+        auto& eng = getEngine<SampleType> (slot);
+
+        configureEngine (eng);
+        syncEngineToHost (eng, 0);
+        eng.process (buffer);
+        return;
+    }
+
+    auto& eng = engines[(size_t) slot];
+    configureEngine (eng);
+
+    auto renderChunk = [this, &eng] (juce::AudioBuffer<float>& block, int hostOffset)
+    {
+        syncEngineToHost (eng, hostOffset);
+        eng.process (block);
+    };
+
+    if constexpr (std::is_same_v<SampleType, float>)
+    {
+        internalRate.process (buffer, renderChunk);
+    }
+    else
+    {
+        // The internal rate core is float-only
+        const int numSamples = buffer.getNumSamples();
+        const int numCh      = juce::jmin (buffer.getNumChannels(), floatScratch.getNumChannels());
+
+        floatScratch.setSize (floatScratch.getNumChannels(), numSamples, false, false, true);
+
+        juce::AudioBuffer<float> view (floatScratch.getArrayOfWritePointers(), numCh, numSamples);
+        internalRate.process (view, renderChunk);
+
+        buffer.clear();
+
+        for (int ch = 0; ch < numCh; ++ch)
+        {
+            const auto* src = view.getReadPointer (ch);
+            auto* dst = buffer.getWritePointer (ch);
+
+            for (int i = 0; i < numSamples; ++i)
+                dst[i] = (double) src[i];
+        }
+    }
+}
+
+void AXISAudioProcessor::renderThroughFloat (juce::AudioBuffer<double>& buffer, juce::MidiBuffer& midiMessages)
+{
+    const int numSamples = buffer.getNumSamples();
+    const int numCh      = juce::jmin (buffer.getNumChannels(), floatScratch.getNumChannels());
+
+    // Only reallocates if the host exceeds the prepared block size
+    floatScratch.setSize (floatScratch.getNumChannels(), numSamples, false, false, true);
+
+    juce::AudioBuffer<float> view (floatScratch.getArrayOfWritePointers(), numCh, numSamples);
+    renderBlock (view, midiMessages);
+
+    buffer.clear();
+
+    for (int ch = 0; ch < numCh; ++ch)
+    {
+        const auto* src = view.getReadPointer (ch);
+        auto* dst = buffer.getWritePointer (ch);
+
+        for (int i = 0; i < numSamples; ++i)
+            dst[i] = (double) src[i];
+    }
+}
+
+template <typename SampleType>
+void AXISAudioProcessor::applyChassis (juce::AudioBuffer<SampleType>& buffer)
+{
+    chassis.setBody (getMacro (AxisPreset::body));
+    chassis.setMix (apvts.getRawParameterValue ("CHASSIS")->load());
+
+    // ACN channels 0 / 1 are W / Y: convolving them with the stereo IRs
+    // would corrupt the soundfield
+    if (! chassis.isActive() || ambisonicOutput)
+        return;
+
+    // Stereo IRs: on larger speaker layouts only the front L / R pair is convolved
+    if constexpr (std::is_same_v<SampleType, float>)
+    {
+        juce::AudioBuffer<float> front (buffer.getArrayOfWritePointers(),
+                                        juce::jmin (2, buffer.getNumChannels()),
+                                        buffer.getNumSamples());
+        chassis.process (front);
+    }
+    else
+    {
+        const int numSamples = buffer.getNumSamples();
+        const int numCh      = juce::jmin (2, buffer.getNumChannels(), floatScratch.getNumChannels());
+
+        floatScratch.setSize (floatScratch.getNumChannels(), numSamples, false, false, true);
+        juce::AudioBuffer<float> view (floatScratch.getArrayOfWritePointers(), numCh, numSamples);
+
+        for (int ch = 0; ch < numCh; ++ch)
+        {
+            const auto* src = buffer.getReadPointer (ch);
+            auto* dst = view.getWritePointer (ch);
+
+            for (int i = 0; i < numSamples; ++i)
+                dst[i] = (float) src[i];
+        }
+
+        chassis.process (view);
+
+        for (int ch = 0; ch < numCh; ++ch)
+        {
+            const auto* src = view.getReadPointer (ch);
+            auto* dst = buffer.getWritePointer (ch);
+
+            for (int i = 0; i < numSamples; ++i)
+                dst[i] = (double) src[i];
+        }
+    }
+}
+
+template <typename SampleType>
+void AXISAudioProcessor::applyOutputSafety (juce::AudioBuffer<SampleType>& buffer)
+{
+    if (apvts.getRawParameterValue ("SAFETY")->load() < 0.5f)
+    {
+        outputSafetyWasOn = false;
+        return;
+    }
+
+    auto& stage = [this]() -> AxisOutputStage<SampleType>&
+    {
+        if constexpr (std::is_same_v<SampleType, float>)
+            return outputStage;
+        else
+            return outputStageDouble;
+    }();
+
+    if (! outputSafetyWasOn)
+    {
+        stage.reset();
+        outputSafetyWasOn = true;
+    }
+
+    stage.process (buffer.getArrayOfWritePointers(), buffer.getNumChannels(), buffer.getNumSamples());
+
+    // Peak hold for the editor, which may redraw less often than blocks arrive
+    const float reduction = stage.getGainReduction();
+
+    if (reduction > outputReduction.load (std::memory_order_relaxed))
+        outputReduction.store (reduction, std::memory_order_relaxed);
 }
 
 
@@ -179,15 +1060,51 @@ juce::AudioProcessorEditor* AXISAudioProcessor::createEditor()
 //==============================================================================
 void AXISAudioProcessor::getStateInformation (juce::MemoryBlock& destData)
 {
-    // You should use this method to store your parameters in the memory block.
-    // You could do that either as raw data, or use the XML or ValueTree classes
-    // as intermediaries to make it easy to save and load complex data.
+    auto state = apvts.copyState();
+
+    // Morph corners aren't parameters: one child per corner, one property per macro
+    juce::ValueTree snapshots (morphStateType);
+
+    for (size_t corner = 0; corner < numMorphSnapshots; ++corner)
+    {
+        juce::ValueTree snapshot ("SNAPSHOT");
+
+        for (size_t m = 0; m < AxisPreset::numMacros; ++m)
+            snapshot.setProperty (AxisPreset::macroIDs[m], morphSnapshots[corner][m].load(), nullptr);
+
+        snapshots.appendChild (snapshot, nullptr);
+    }
+
+    state.removeChild (state.getChildWithName (morphStateType), nullptr);
+    state.appendChild (snapshots, nullptr);
+
+    if (auto xml = state.createXml())
+        copyXmlToBinary (*xml, destData);
 }
 
 void AXISAudioProcessor::setStateInformation (const void* data, int sizeInBytes)
 {
-    // You should use this method to restore your parameters from this memory block,
-    // whose contents will have been created by the getStateInformation() call.
+    const auto xml = getXmlFromBinary (data, sizeInBytes);
+
+    if (xml == nullptr || ! xml->hasTagName (apvts.state.getType()))
+        return;
+
+    auto state = juce::ValueTree::fromXml (*xml);
+
+    // Corners missing from older states keep their current values
+    const auto snapshots = state.getChildWithName (morphStateType);
+
+    for (int corner = 0; corner < juce::jmin (numMorphSnapshots, snapshots.getNumChildren()); ++corner)
+    {
+        const auto snapshot = snapshots.getChild (corner);
+
+        for (size_t m = 0; m < AxisPreset::numMacros; ++m)
+            if (snapshot.hasProperty (AxisPreset::macroIDs[m]))
+                morphSnapshots[(size_t) corner][m].store ((float) snapshot.getProperty (AxisPreset::macroIDs[m]));
+    }
+
+    state.removeChild (snapshots, nullptr);
+    apvts.replaceState (state);
 }
 
 //==============================================================================
@@ -10,11 +10,22 @@
 
 #include <JuceHeader.h>
 #include "AxisEngine.h"
+#include "AxisVoiceBank.h"
+#include "AxisInternalRate.h"
+#include "AxisQualityGovernor.h"
+#include "AxisChassis.h"
+#include "AxisOutputStage.h"
+#include "AxisLoopCache.h"
+#include "AxisTransportGate.h"
+#include "AxisAnalyser.h"
+#include "AxisPresetBank.h"
+#include "AxisModMatrix.h"
 
 //==============================================================================
 /**
 */
-class AXISAudioProcessor  : public juce::AudioProcessor
+class AXISAudioProcessor  : public juce::AudioProcessor,
+                            private juce::AsyncUpdater
 {
 public:
     //==============================================================================
@@ -33,6 +44,29 @@ public:
    #endif
 
     void processBlock (juce::AudioBuffer<float>&, juce::MidiBuffer&) override;
+    void processBlock (juce::AudioBuffer<double>&, juce::MidiBuffer&) override;
+    bool supportsDoublePrecisionProcessing() const override { return true; }
+
+    // Quality governor state for the editor
+    int getQualityTier() const noexcept  { return governor.getActiveTier(); }
+    float getCpuLoad() const noexcept    { return governor.getLoad(); }
+    float getModulationLoad() const noexcept   { return modulationLoad.load(); }
+
+    // Engine state for the editor's rotation view (read on the message thread)
+    AxisTelemetry& getTelemetry() noexcept   { return telemetry; }
+
+    // Safety limiter gain reduction in dB, the largest since the last read
+    float takeOutputReduction() noexcept     { return outputReduction.exchange (0.0f); }
+
+    // Output spectrum / scope, only running while the editor is open
+    AxisAnalyser& getAnalyser() noexcept     { return analyser; }
+
+    // XY morph: MORPH_X / MORPH_Y interpolate the macros between snapshots
+    // A (top left), B (top right), C (bottom left) and D (bottom right)
+    static constexpr int numMorphSnapshots = 4;
+
+    // Message thread: capture the current macro parameters into a snapshot
+    void storeMorphSnapshot (int index);
 
     //==============================================================================
     juce::AudioProcessorEditor* createEditor() override;
@@ -58,6 +92,220 @@ public:
     void setStateInformation (const void* data, int sizeInBytes) override;
 
 private:
-    AxisEngine engine;
+    // Two engines per precision: the live one and a standby that takes over
+    // under a crossfade (see the engine switching section below)
+    std::array<AxisEngine<float>, 2> engines;
+    std::array<AxisEngine<double>, 2> enginesDouble;
+    AxisVoiceBank voiceBank;
+    AxisInternalRate internalRate;
+    AxisQualityGovernor governor;
+    AxisChassis chassis;
+    AxisLoopCache loopCache;
+    AxisTransportGate transportGate;
+    AxisTelemetry telemetry;
+    AxisAnalyser analyser;
+    AxisPresetBank presets;
+    AxisModMatrix modMatrix;
+
+    template <typename SampleType>
+    void processBlockImpl (juce::AudioBuffer<SampleType>& buffer, juce::MidiBuffer& midiMessages);
+
+    template <typename SampleType>
+    void renderBlock (juce::AudioBuffer<SampleType>& buffer, juce::MidiBuffer& midiMessages);
+
+    // Renders one engine slot, at the internal rate (float-only) or host rate
+    template <typename SampleType>
+    void renderEngine (int slot, bool atInternalRate, juce::AudioBuffer<SampleType>& buffer);
+
+    template <typename SampleType>
+    void configureEngine (AxisEngine<SampleType>& eng);
+
+    // Float-only voice bank in the double path
+    void renderThroughFloat (juce::AudioBuffer<double>& buffer, juce::MidiBuffer& midiMessages);
+
+    // Chassis convolution post stage (float-only, like the stages above).
+    // Bypassed on ambisonic buses, which have no L / R pair to convolve.
+    template <typename SampleType>
+    void applyChassis (juce::AudioBuffer<SampleType>& buffer);
+    bool ambisonicOutput = false;
+
+    // DC blocker + limiter (SAFETY), the last stage of every path: after the
+    // voice bank, the internal-rate filters, the chassis and the loop cache
+    template <typename SampleType>
+    void applyOutputSafety (juce::AudioBuffer<SampleType>& buffer);
+
+    AxisOutputStage<float> outputStage;
+    AxisOutputStage<double> outputStageDouble;
+
+    // The stages don't run while SAFETY is off, so their DC blocker state is
+    // stale by the time it's switched back on
+    bool outputSafetyWasOn = false;
+    std::atomic<float> outputReduction { 0.0f };
+
+    template <typename SampleType>
+    AxisEngine<SampleType>& getEngine (int slot)
+    {
+        if constexpr (std::is_same_v<SampleType, float>)
+            return engines[(size_t) slot];
+        else
+            return enginesDouble[(size_t) slot];
+    }
+
+    // The engine a slot renders with: float at the internal rate or in a
+    // float host, double otherwise
+    template <typename Fn>
+    void withRenderingEngine (int slot, bool atInternalRate, Fn&& fn)
+    {
+        if (atInternalRate || ! isUsingDoublePrecision())
+            fn (engines[(size_t) slot]);
+        else
+            fn (enginesDouble[(size_t) slot]);
+    }
+
+    // Every engine the audio thread owns: all of them, except the standby
+    // pair while the message thread is preparing it
+    template <typename Fn>
+    void forEachEngine (Fn&& fn)
+    {
+        const bool standbyOwned = switchState.load (std::memory_order_acquire) != switchPreparing;
+
+        for (int slot = 0; slot < 2; ++slot)
+        {
+            if (slot != liveEngine && ! standbyOwned)
+                continue;
+
+            fn (engines[(size_t) slot]);
+            fn (enginesDouble[(size_t) slot]);
+        }
+    }
+
+    // Engine tiers go through the engine switch; the voice bank follows directly
+    void applyQualityTier();
+
+    // Play head state at the start of the block
+    void readHostPosition();
+    bool hostPlaying = true;
+    bool hostHasPosition = false;   // playing with a valid ppq / tempo
+    double hostPpq = 0.0;
+    double hostBpm = 120.0;
+
+    // Beats per rotation cycle for the RATEDIV choice
+    static double getBeatsPerCycle (int divisionIndex);
+
+    // Passes the play head position to an engine about to render at hostOffset
+    template <typename SampleType>
+    void syncEngineToHost (AxisEngine<SampleType>& eng, int hostOffset);
+    void resetForPlayback();
+
+    // ---- Program changes ----
+    // setCurrentProgram() only stores atomics. The audio thread picks the
+    // preset up at the next block and glides the macros to it, while the
+    // message thread writes the preset into the parameters. Discrete
+    // settings among them (bank size, mode, modal modes) then crossfade
+    // through the engine switch like any other change to them.
+    void handleAsyncUpdate() override;
+    void applyProgramToParameters();
+    void beginPresetRecall();
+
+    // Macros for this block: parameters, or the recalled preset until its
+    // values have reached the parameters, with the recall glide applied
+    void updateMacros (int numSamples);
+    float getMacro (AxisPreset::Macro macro) const noexcept   { return macros[(size_t) macro]; }
+
+    std::array<std::atomic<float>*, AxisPreset::numMacros> macroParameters {};
+    std::array<float, AxisPreset::numMacros> baseMacros {};   // before modulation
+    std::array<float, AxisPreset::numMacros> macros {};
+
+    // Modulation matrix: sources advanced and routes applied once per block
+    template <typename SampleType>
+    void updateModulation (const juce::AudioBuffer<SampleType>& buffer);
+
+    std::array<std::atomic<float>*, AxisModMatrix::numSlots> modSourceParameters {}, modTargetParameters {}, modDepthParameters {};
+    std::atomic<float> modulationLoad { 0.0f };   // matrix time / block time
+
+    std::atomic<int> currentProgram { 0 };
+    std::atomic<int> pendingProgram { -1 };
+    std::atomic<juce::uint32> programSerial { 0 };    // bumped by setCurrentProgram
+    std::atomic<juce::uint32> appliedSerial { 0 };    // last one written to the parameters
+
+    static constexpr double presetGlideSeconds = 0.06;
+    std::array<float, AxisPreset::numMacros> glideStart {}, presetMacros {};
+    bool presetOverride = false;
+    juce::uint32 overrideSerial = 0;
+    int glideSamples = 0, glideRemaining = 0;
+
+    // ---- Morph ----
+    // Snapshots are written on the message thread, read per block and saved
+    // with the plugin state, next to the parameters
+    std::array<std::array<std::atomic<float>, AxisPreset::numMacros>, numMorphSnapshots> morphSnapshots;
+    std::array<float, AxisPreset::numMacros> getMorphMacros() const noexcept;
+    static constexpr const char* morphStateType = "MORPHSNAPSHOTS";
+
+    // True if any parameter changed since the last call (eco freeze)
+    bool parametersMoved();
+    std::vector<float> parameterSnapshot;
+
+    // Latency is worked out on the audio thread and reported to the host
+    // from the message thread
+    int getEngineLatency() const;
+    void updateLatency();
+    std::atomic<int> pendingLatency { -1 };
+
+    // ---- Engine switching ----
+    // Discrete settings can't change under a running engine without a click:
+    // they go to the standby pair, which picks up the live engines' timeline
+    // and takes over under a crossfade while both render. A new internal rate
+    // means re-preparing, which the message thread does first.
+    enum SwitchState { switchIdle = 0, switchPreparing, switchReady, switchFading };
+
+    struct EngineConfig
+    {
+        bool internalRate = false;
+        int mode = 0, spectralSize = 0, spectralOverlap = 0;
+        int numFilters = 2, modalModes = 0;
+        int oversampling = 0;
+        int tier = AxisQualityGovernor::full;
+
+        bool operator== (const EngineConfig& other) const noexcept
+        {
+            return internalRate == other.internalRate && mode == other.mode
+                && spectralSize == other.spectralSize && spectralOverlap == other.spectralOverlap
+                && numFilters == other.numFilters && modalModes == other.modalModes
+                && oversampling == other.oversampling && tier == other.tier;
+        }
+
+        bool operator!= (const EngineConfig& other) const noexcept   { return ! operator== (other); }
+    };
+
+    EngineConfig getWantedConfig() const;
+    bool wantsInternalRate() const;
+
+    template <typename SampleType>
+    static void applyEngineConfig (AxisEngine<SampleType>& eng, const EngineConfig& config);
+
+    void updateEngineSwitch();
+    void prepareStandbyEngines();
+    void beginEngineFade();
+    void finishEngineFade();
+
+    template <typename SampleType>
+    void crossfadeEngines (juce::AudioBuffer<SampleType>& buffer, const juce::AudioBuffer<SampleType>& incoming);
+
+    int getStandbyEngine() const noexcept   { return 1 - liveEngine; }
+
+    std::atomic<int> switchState { switchIdle };
+    int liveEngine = 0;
+    EngineConfig liveConfig, standbyConfig;
+    std::array<bool, 2> preparedForInternalRate {};     // per slot, rate of the last prepare()
+
+    static constexpr double engineFadeSeconds = 0.03;
+    int engineFadeSamples = 1, engineFadeRemaining = 0;
+    juce::AudioBuffer<float> fadeScratch;
+    juce::AudioBuffer<double> fadeScratchDouble;
+
+    double hostSampleRate = 44100.0;
+    int hostBlockSize = 512;
+
+    juce::AudioBuffer<float> floatScratch;
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (AXISAudioProcessor)
 };